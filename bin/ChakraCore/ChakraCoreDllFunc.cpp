@@ -93,6 +93,11 @@ static void DetachProcess()
     // other dlls.
     JsrtRuntime::Uninitialize();
 
+#if ENABLE_SHARED_PAGE_POOL
+    // All runtimes are gone; give the pages they left behind back to the OS
+    SharedPagePool::Instance.Flush();
+#endif
+
     // thread-bound entrypoint should be able to get cleanup correctly, however tlsentry
     // for current thread might be left behind if this thread was initialized.
     ThreadContextTLSEntry::CleanupThread();
@@ -36,6 +36,10 @@ static const unsigned int initializeCount = 10000;
 static const unsigned int operationsPerHeapWalk = 100000;
 #endif
 
+// In concurrent sweep alloc mode, a concurrent collection is started this often so that
+// most heap operations allocate while the background thread is still sweeping.
+static const unsigned int operationsPerConcurrentCollect = 2000;
+
 // Some global variables
 
 // Recycler instance
@@ -68,6 +72,9 @@ WeightedTable<Operation> operationTable;
 // Not used currently, but keep for now
 bool verbose = false;
 
+// Keep starting concurrent collections so that allocations race with the background sweep
+bool concurrentSweepAllocMode = false;
+
 
 RecyclerTestObject * CreateNewObject()
 {
@@ -328,6 +335,14 @@ void SimpleRecyclerTest()
         {
             for (unsigned int i = 0; i < operationsPerHeapWalk; i++)
             {
+                if (concurrentSweepAllocMode && (i % operationsPerConcurrentCollect) == 0)
+                {
+                    // Finishes the previous concurrent collection, if any, and returns as soon as the
+                    // background thread has taken over. The operations that follow allocate from heap
+                    // blocks as the background thread hands them back during sweep.
+                    recyclerInstance->CollectNow<CollectNowConcurrent>();
+                }
+
                 DoHeapOperation();
             }
             
@@ -367,8 +382,9 @@ bool GetDeviceFamilyInfo(
 void usage(const WCHAR* self)
 {
     wprintf(
-        _u("usage: %s [-?|-v] [-js <jscript options from here on>]\n")
-        _u("  -v\n\tverbose logging\n"),
+        _u("usage: %s [-?|-v|-sweepalloc] [-js <jscript options from here on>]\n")
+        _u("  -v\n\tverbose logging\n")
+        _u("  -sweepalloc\n\tstress allocations during concurrent sweep\n"),
         self);
 }
 
@@ -389,6 +405,10 @@ int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
             {
                 verbose = true;
             }
+            else if (wcscmp(argv[i], _u("-sweepalloc")) == 0)
+            {
+                concurrentSweepAllocMode = true;
+            }
             else if (wcscmp(argv[i], _u("-js")) == 0 || wcscmp(argv[i], _u("-JS")) == 0)
             {
                 jscriptOptions = i;
@@ -280,4 +280,51 @@ namespace CodexTest
         
         RunUtf8DecodeTestCase(testCases, utf8::DecodeUnitsIntoAndNullTerminateNoAdvance);
     }
+
+    //
+    // Runs of ASCII are converted in blocks; check runs of every length, starting at every
+    // alignment, with and without a non-ASCII character somewhere in the run
+    //
+    TEST_CASE("CodexTest_AsciiRuns_RoundTrip", "[CodexTest]")
+    {
+        const size_t maxLength = 100;
+        utf8char_t source[maxLength + 8];
+        char16 decodedBuffer[maxLength + 8];
+        utf8char_t encodedBuffer[(maxLength + 8) * 3 + 1];
+
+        for (size_t length = 1; length <= maxLength; length++)
+        {
+            for (size_t offset = 0; offset < 4; offset++)
+            {
+                for (size_t nonAsciiIndex = 0; nonAsciiIndex <= length; nonAsciiIndex += 5)
+                {
+                    utf8char_t *start = source + offset;
+                    for (size_t i = 0; i < length; i++)
+                    {
+                        start[i] = (utf8char_t)('a' + i % 26);
+                    }
+
+                    // U+00E9 takes the place of two ASCII characters
+                    size_t expectedChars = length;
+                    if (nonAsciiIndex + 1 < length)
+                    {
+                        start[nonAsciiIndex] = 0xC3;
+                        start[nonAsciiIndex + 1] = 0xA9;
+                        expectedChars--;
+                    }
+
+                    CHECK(utf8::AsciiPrefixLength(start, length) == (nonAsciiIndex + 1 < length ? nonAsciiIndex : length));
+                    CHECK(utf8::ByteIndexIntoCharacterIndex(start, length) == expectedChars);
+
+                    LPCUTF8 current = start;
+                    size_t decodedChars = utf8::DecodeUnitsInto(decodedBuffer + offset, current, start + length);
+                    REQUIRE(decodedChars == expectedChars);
+
+                    size_t encodedBytes = utf8::EncodeTrueUtf8IntoAndNullTerminate(encodedBuffer + offset, decodedBuffer + offset, (charcount_t)decodedChars);
+                    REQUIRE(encodedBytes == length);
+                    CHECK(memcmp(encodedBuffer + offset, start, length) == 0);
+                }
+            }
+        }
+    }
 };
\ No newline at end of file
@@ -2621,4 +2621,211 @@ namespace JsRTApiTest
     {
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringTest);
     }
+
+    void JsCreateStringAsciiTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // ASCII strings are stored one byte per character until they are needed as UTF-16
+        const char asciiInput[] = "Hello, World";
+        const size_t asciiLength = strlen(asciiInput);
+        JsValueRef result;
+        REQUIRE(JsCreateString(asciiInput, asciiLength, &result) == JsNoError);
+
+        size_t written;
+        REQUIRE(JsCopyString(result, nullptr, 0, &written) == JsNoError);
+        CHECK(written == asciiLength);
+
+        char utf8Result[16];
+        REQUIRE(JsCopyString(result, utf8Result, 5, &written) == JsNoError);
+        CHECK(written == 5);
+        CHECK(memcmp(utf8Result, asciiInput, written) == 0);
+
+        // Concatenation copies out of the one-byte buffer
+        JsValueRef concatFunction;
+        REQUIRE(JsRunScript(_u("(function (s) { return s + s; })"), JS_SOURCE_CONTEXT_NONE, _u(""), &concatFunction) == JsNoError);
+        JsValueRef args[] = { GetUndefined(), result };
+        JsValueRef concat;
+        REQUIRE(JsCallFunction(concatFunction, args, _countof(args), &concat) == JsNoError);
+        LPCWSTR concatString;
+        size_t concatLength;
+        REQUIRE(JsStringToPointer(concat, &concatString, &concatLength) == JsNoError);
+        CHECK(concatLength == asciiLength * 2);
+        CHECK(concatString[asciiLength] == _u('H'));
+        CHECK(concatString[asciiLength * 2 - 1] == _u('d'));
+
+        REQUIRE(JsCopyString(result, utf8Result, sizeof(utf8Result), &written) == JsNoError);
+        CHECK(written == asciiLength);
+        CHECK(memcmp(utf8Result, asciiInput, written) == 0);
+
+        // Once widened, the string behaves the same
+        LPCWSTR stringPtr;
+        size_t stringLength;
+        REQUIRE(JsStringToPointer(result, &stringPtr, &stringLength) == JsNoError);
+        CHECK(stringLength == asciiLength);
+        CHECK(!wcscmp(stringPtr, _u("Hello, World")));
+
+        REQUIRE(JsCopyString(result, utf8Result, sizeof(utf8Result), &written) == JsNoError);
+        CHECK(written == asciiLength);
+        CHECK(memcmp(utf8Result, asciiInput, written) == 0);
+    }
+
+    TEST_CASE("ApiTest_JsCreateStringAsciiTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringAsciiTest);
+    }
+
+    void CheckJsonValue(JsValueRef stringifyFunction, JsValueRef value, LPCWSTR expected)
+    {
+        REQUIRE(value != JS_INVALID_REFERENCE);
+        JsValueRef args[] = { GetUndefined(), value };
+        JsValueRef json;
+        REQUIRE(JsCallFunction(stringifyFunction, args, _countof(args), &json) == JsNoError);
+        LPCWSTR jsonString;
+        size_t jsonLength;
+        REQUIRE(JsStringToPointer(json, &jsonString, &jsonLength) == JsNoError);
+        CHECK(!wcscmp(jsonString, expected));
+    }
+
+    void JsJsonParseSessionTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef stringifyFunction;
+        REQUIRE(JsRunScript(_u("(function (v) { return JSON.stringify(v); })"), JS_SOURCE_CONTEXT_NONE, _u(""), &stringifyFunction) == JsNoError);
+
+        // Newline-delimited values, fed a few bytes at a time so that chunks split values and the UTF-8 sequence
+        const char ndjson[] = "{\"id\":1,\"name\":\"caf\xC3\xA9\"}\n[1,2,{\"a\":null}]\n\"x\\\"y\"\n-12.5e1 true\n";
+        JsJsonParseSessionHandle session;
+        REQUIRE(JsCreateJsonParseSession(JsJsonParseMode_Values, &session) == JsNoError);
+
+        const size_t ndjsonLength = strlen(ndjson);
+        for (size_t offset = 0; offset < ndjsonLength; offset += 3)
+        {
+            size_t length = min(ndjsonLength - offset, (size_t)3);
+            REQUIRE(JsJsonParseSessionAddChunk(session, ndjson + offset, length, false) == JsNoError);
+        }
+
+        // The last value isn't complete until the input ends
+        JsValueRef value;
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("{\"id\":1,\"name\":\"caf\u00e9\"}"));
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("[1,2,{\"a\":null}]"));
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("\"x\\\"y\""));
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("-125"));
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("true"));
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CHECK(value == JS_INVALID_REFERENCE);
+
+        REQUIRE(JsJsonParseSessionAddChunk(session, nullptr, 0, true) == JsNoError);
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CHECK(value == JS_INVALID_REFERENCE);
+        REQUIRE(JsReleaseJsonParseSession(session) == JsNoError);
+
+        // Elements of one top-level array
+        const char array[] = " [ {\"a\":[1]} , 2,\"three\" ] ";
+        REQUIRE(JsCreateJsonParseSession(JsJsonParseMode_ArrayElements, &session) == JsNoError);
+        REQUIRE(JsJsonParseSessionAddChunk(session, array, 12, false) == JsNoError);
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("{\"a\":[1]}"));
+        REQUIRE(JsJsonParseSessionAddChunk(session, array + 12, strlen(array) - 12, true) == JsNoError);
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("2"));
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CheckJsonValue(stringifyFunction, value, _u("\"three\""));
+        REQUIRE(JsJsonParseSessionGetNextValue(session, &value) == JsNoError);
+        CHECK(value == JS_INVALID_REFERENCE);
+        REQUIRE(JsReleaseJsonParseSession(session) == JsNoError);
+
+        // Syntax errors are reported as SyntaxError exceptions, and end the session
+        const char invalid[] = "{\"a\":1,}";
+        REQUIRE(JsCreateJsonParseSession(JsJsonParseMode_Values, &session) == JsNoError);
+        REQUIRE(JsJsonParseSessionAddChunk(session, invalid, strlen(invalid), false) == JsErrorScriptException);
+        JsValueRef exception;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        REQUIRE(JsJsonParseSessionAddChunk(session, "1", 1, true) == JsErrorInvalidArgument);
+        REQUIRE(JsReleaseJsonParseSession(session) == JsNoError);
+
+        // An incomplete value at the end of the input is an error too
+        REQUIRE(JsCreateJsonParseSession(JsJsonParseMode_ArrayElements, &session) == JsNoError);
+        REQUIRE(JsJsonParseSessionAddChunk(session, "[1,", 3, true) == JsErrorScriptException);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        REQUIRE(JsReleaseJsonParseSession(session) == JsNoError);
+
+        // Releasing a session that still holds values, tagged numbers among them, unroots the values it holds
+        REQUIRE(JsCreateJsonParseSession(JsJsonParseMode_Values, &session) == JsNoError);
+        REQUIRE(JsJsonParseSessionAddChunk(session, "1 2 {}", 6, true) == JsNoError);
+        REQUIRE(JsReleaseJsonParseSession(session) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_JsJsonParseSessionTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsJsonParseSessionTest);
+    }
+
+    struct JsonUtf8Output
+    {
+        std::string text;
+        int chunkCount;
+    };
+
+    void CHAKRA_CALLBACK AppendJsonUtf8Chunk(const char *chunk, size_t length, void *callbackState)
+    {
+        JsonUtf8Output *output = static_cast<JsonUtf8Output *>(callbackState);
+        output->text.append(chunk, length);
+        output->chunkCount++;
+    }
+
+    void JsJsonStringifyUtf8Test(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Non-ASCII characters, a surrogate pair, a lone surrogate and escapes
+        JsValueRef value;
+        REQUIRE(JsRunScript(_u("({ a: 'caf\\u00e9', b: ['\\ud83d\\ude00', '\\ud800'], c: 'x\"\\n\\u0001' })"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        JsonUtf8Output output = { "", 0 };
+        size_t length;
+        REQUIRE(JsJsonStringifyUtf8(value, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, AppendJsonUtf8Chunk, &output, &length) == JsNoError);
+        CHECK(output.text == "{\"a\":\"caf\xC3\xA9\",\"b\":[\"\xF0\x9F\x98\x80\",\"\xEF\xBF\xBD\"],\"c\":\"x\\\"\\n\\u0001\"}");
+        CHECK(length == output.text.length());
+
+        // Long enough to take several chunks, with a surrogate pair split across the first two
+        REQUIRE(JsRunScript(_u("['a'.repeat(1021) + '\\ud83d\\ude00' + 'b'.repeat(5000)]"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        output.text.clear();
+        output.chunkCount = 0;
+        REQUIRE(JsJsonStringifyUtf8(value, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, AppendJsonUtf8Chunk, &output, &length) == JsNoError);
+        CHECK(output.chunkCount > 1);
+        CHECK(output.text == "[\"" + std::string(1021, 'a') + "\xF0\x9F\x98\x80" + std::string(5000, 'b') + "\"]");
+        CHECK(length == output.text.length());
+
+        // Replacer and space
+        JsValueRef replacer;
+        JsValueRef space;
+        REQUIRE(JsRunScript(_u("({ a: 1, b: [true, null], c: 3 })"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        REQUIRE(JsRunScript(_u("['a', 'b']"), JS_SOURCE_CONTEXT_NONE, _u(""), &replacer) == JsNoError);
+        REQUIRE(JsIntToNumber(2, &space) == JsNoError);
+        output.text.clear();
+        REQUIRE(JsJsonStringifyUtf8(value, replacer, space, AppendJsonUtf8Chunk, &output, nullptr) == JsNoError);
+        CHECK(output.text == "{\n  \"a\": 1,\n  \"b\": [\n    true,\n    null\n  ]\n}");
+
+        // No JSON representation, so no output
+        output.text.clear();
+        output.chunkCount = 0;
+        REQUIRE(JsJsonStringifyUtf8(GetUndefined(), JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, AppendJsonUtf8Chunk, &output, &length) == JsNoError);
+        CHECK(output.chunkCount == 0);
+        CHECK(length == 0);
+
+        // Exceptions from toJSON are reported before anything is written
+        REQUIRE(JsRunScript(_u("({ toJSON() { throw new Error('no'); } })"), JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+        REQUIRE(JsJsonStringifyUtf8(value, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, AppendJsonUtf8Chunk, &output, &length) == JsErrorScriptException);
+        CHECK(output.chunkCount == 0);
+        JsValueRef exception;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+
+        REQUIRE(JsJsonStringifyUtf8(value, JS_INVALID_REFERENCE, JS_INVALID_REFERENCE, nullptr, nullptr, nullptr) == JsErrorNullArgument);
+    }
+
+    TEST_CASE("ApiTest_JsJsonStringifyUtf8Test", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsJsonStringifyUtf8Test);
+    }
 }
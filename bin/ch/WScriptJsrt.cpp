@@ -523,7 +523,22 @@ JsValueRef WScriptJsrt::LoadScript(JsValueRef callee, LPCSTR fileName,
         JsValueRef fname;
         IfJsrtErrorSetGo(ChakraRTInterface::JsCreateString(fullPath,
             strlen(fullPath), &fname));
-        JsSourceContext sourceContext = GetNextSourceContext();
+
+        // Hosts may reuse a cookie for different scripts
+        static JsSourceContext reusedSourceContext = JS_SOURCE_CONTEXT_NONE;
+        JsSourceContext sourceContext;
+        if (HostConfigFlags::flags.ReuseSourceContext)
+        {
+            if (reusedSourceContext == JS_SOURCE_CONTEXT_NONE)
+            {
+                reusedSourceContext = GetNextSourceContext();
+            }
+            sourceContext = reusedSourceContext;
+        }
+        else
+        {
+            sourceContext = GetNextSourceContext();
+        }
         RegisterScriptDir(sourceContext, fullPath);
         errorCode = ChakraRTInterface::JsRun(scriptSource, sourceContext,
             fname, JsParseScriptAttributeNone, &returnValue);
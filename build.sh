@@ -57,6 +57,8 @@ PRINT_USAGE() {
     echo "     --libs-only       Do not build CH and GCStress"
     echo "     --lto             Enables LLVM Full LTO"
     echo "     --lto-thin        Enables LLVM Thin LTO - xcode 8+ or clang 3.9+"
+    echo "     --huge-page-segments"
+    echo "                       Enables 2MB page segments backed by huge pages (64-bit)"
     echo "     --lttng           Enables LTTng support for ETW events"
     echo "     --static          Build as static library. Default: shared library"
     echo "     --sanitize=CHECKS Build with clang -fsanitize checks,"
@@ -64,6 +66,8 @@ PRINT_USAGE() {
     echo " -t, --test-build      Test build. Enables test flags on a release build."
     echo "     --target[=S]      Target OS (i.e. android)"
     echo "     --target-path[=S] Output path for compiled binaries. Default: out/"
+    echo "     --threaded-interpreter"
+    echo "                       Dispatch interpreter opcodes through a computed goto table"
     echo "     --trace           Enables experimental built-in trace."
     echo "     --xcode           Generate XCode project."
     echo "     --without-intl    Disable Intl (ECMA 402) support"
@@ -100,6 +104,7 @@ EXTRA_DEFINES=""
 MAKE=make
 MULTICORE_BUILD=""
 NO_JIT=
+THREADED_INTERPRETER=
 CMAKE_ICU="-DICU_SETTINGS_RESET=1"
 CMAKE_INTL="-DINTL_ICU_SH=1" # default to enabling intl
 USE_LOCAL_ICU=0 # default to using system version of ICU
@@ -120,6 +125,7 @@ WB_ANALYZE=
 WB_ARGS=
 TARGET_PATH=0
 VALGRIND=0
+HUGE_PAGE_SEGMENTS=
 # -DCMAKE_EXPORT_COMPILE_COMMANDS=ON useful for clang-query tool
 CMAKE_EXPORT_COMPILE_COMMANDS="-DCMAKE_EXPORT_COMPILE_COMMANDS=ON"
 LIBS_ONLY_BUILD=
@@ -277,6 +283,10 @@ while [[ $# -gt 0 ]]; do
         NO_JIT="-DNO_JIT_SH=1"
         ;;
 
+    --threaded-interpreter)
+        THREADED_INTERPRETER="-DTHREADED_INTERPRETER_SH=1"
+        ;;
+
     --without-intl)
         CMAKE_INTL="-DINTL_ICU_SH=0"
         ;;
@@ -377,6 +387,10 @@ while [[ $# -gt 0 ]]; do
         VALGRIND="-DENABLE_VALGRIND_SH=1"
         ;;
 
+    --huge-page-segments)
+        HUGE_PAGE_SEGMENTS="-DHUGE_PAGE_SEGMENTS_SH=1"
+        ;;
+
     -y | -Y)
         ALWAYS_YES=-y
         ;;
@@ -652,9 +666,9 @@ fi
 echo Generating $BUILD_TYPE makefiles
 echo $EXTRA_DEFINES
 cmake $CMAKE_GEN $CC_PREFIX $CMAKE_ICU $LTO $LTTNG $STATIC_LIBRARY $ARCH $TARGET_OS \
-    $ENABLE_CC_XPLAT_TRACE $EXTRA_DEFINES -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $CMAKE_INTL \
+    $ENABLE_CC_XPLAT_TRACE $EXTRA_DEFINES -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $THREADED_INTERPRETER $CMAKE_INTL \
     $WITHOUT_FEATURES $WB_FLAG $WB_ARGS $CMAKE_EXPORT_COMPILE_COMMANDS $LIBS_ONLY_BUILD\
-    $VALGRIND $BUILD_RELATIVE_DIRECTORY
+    $VALGRIND $HUGE_PAGE_SEGMENTS $BUILD_RELATIVE_DIRECTORY
 
 _RET=$?
 if [[ $? == 0 ]]; then
@@ -3535,6 +3535,15 @@ GlobOpt::CopyProp(IR::Opnd *opnd, IR::Instr *instr, Value *val, IR::IndirOpnd *p
         return opnd;
     }
 
+    // Same for the wasm bulk memory instrs, each one has its exclusive EA sequence
+    if ((instr->m_opcode == Js::OpCode::CopyWasmMemory ||
+         instr->m_opcode == Js::OpCode::FillWasmMemory ||
+         instr->m_opcode == Js::OpCode::CopyWasmTable) &&
+        opnd == instr->GetSrc2())
+    {
+        return opnd;
+    }
+
     // Don't copy-prop operand of SIMD instr with ExtendedArg operands. Each instr should have its exclusive EA sequence.
     if (
             Js::IsSimd128Opcode(instr->m_opcode) &&
@@ -2486,6 +2486,41 @@ IRBuilderAsmJs::BuildInt2(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot
     }
 }
 
+void
+IRBuilderAsmJs::BuildReg1Int3(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot tableReg, Js::RegSlot dstRegSlot, Js::RegSlot srcRegSlot, Js::RegSlot countRegSlot)
+{
+    Assert(newOpcode == Js::OpCodeAsmJs::TableCopy);
+    IR::RegOpnd * tableOpnd = BuildSrcOpnd(GetRegSlotFromPtrReg(tableReg), TyMachReg);
+    BuildWasmBulkMemory(Js::OpCode::CopyWasmTable, offset, tableOpnd, dstRegSlot, srcRegSlot, countRegSlot);
+}
+
+void
+IRBuilderAsmJs::BuildWasmBulkMemory(Js::OpCode opcode, uint32 offset, IR::Opnd * targetOpnd, Js::RegSlot dstRegSlot, Js::RegSlot srcRegSlot, Js::RegSlot countRegSlot)
+{
+    IR::RegOpnd * dstOpnd = BuildSrcOpnd(dstRegSlot, TyInt32);
+    dstOpnd->SetValueType(ValueType::GetInt(false));
+    IR::RegOpnd * srcOpnd = BuildSrcOpnd(srcRegSlot, TyInt32);
+    srcOpnd->SetValueType(ValueType::GetInt(false));
+    IR::RegOpnd * countOpnd = BuildSrcOpnd(countRegSlot, TyInt32);
+    countOpnd->SetValueType(ValueType::GetInt(false));
+
+    // Given bytecode: op target, dst, src, count
+    // Generate:
+    // t1 = ExtendedArg_A dst
+    // t2 = ExtendedArg_A src, t1
+    // t3 = ExtendedArg_A count, t2
+    // op target, t3
+    // The lowerer follows the chain to pass the operands to the helper, which does a single bounds check
+    IR::Instr * instr = AddExtendedArg(dstOpnd, nullptr, offset);
+    instr = AddExtendedArg(srcOpnd, instr->GetDst()->AsRegOpnd(), offset);
+    instr = AddExtendedArg(countOpnd, instr->GetDst()->AsRegOpnd(), offset);
+
+    IR::Instr * opInstr = IR::Instr::New(opcode, m_func);
+    opInstr->SetSrc1(targetOpnd);
+    opInstr->SetSrc2(instr->GetDst());
+    AddInstr(opInstr, offset);
+}
+
 IR::RegOpnd* IRBuilderAsmJs::BuildTrapIfZero(IR::RegOpnd* srcOpnd, uint32 offset)
 {
     IR::RegOpnd* newSrc = IR::RegOpnd::New(srcOpnd->GetType(), m_func);
@@ -2514,6 +2549,19 @@ IR::Instr* IRBuilderAsmJs::CreateSignExtendInstr(IR::Opnd* dst, IR::Opnd* src, I
 void
 IRBuilderAsmJs::BuildInt3(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstRegSlot, Js::RegSlot src1RegSlot, Js::RegSlot src2RegSlot)
 {
+    if (newOpcode == Js::OpCodeAsmJs::MemoryCopy || newOpcode == Js::OpCodeAsmJs::MemoryFill)
+    {
+        // The first register is the destination address, these opcodes don't have a result
+        BuildWasmBulkMemory(
+            newOpcode == Js::OpCodeAsmJs::MemoryCopy ? Js::OpCode::CopyWasmMemory : Js::OpCode::FillWasmMemory,
+            offset,
+            BuildSrcOpnd(AsmJsRegSlots::WasmMemoryReg, TyVar),
+            dstRegSlot,
+            src1RegSlot,
+            src2RegSlot);
+        return;
+    }
+
     IR::RegOpnd * src1Opnd = BuildSrcOpnd(src1RegSlot, TyInt32);
     src1Opnd->SetValueType(ValueType::GetInt(false));
 
@@ -159,6 +159,7 @@ class IRBuilderAsmJs
     Js::OpCode              GetSimdOpcode(Js::OpCodeAsmJs asmjsOpcode);
     void                    GetSimdTypesFromAsmType(Js::AsmJsType::Which asmType, IRType *pIRType, ValueType *pValueType = nullptr);
     IR::Instr *             AddExtendedArg(IR::RegOpnd *src1, IR::RegOpnd *src2, uint32 offset);
+    void                    BuildWasmBulkMemory(Js::OpCode opcode, uint32 offset, IR::Opnd * targetOpnd, Js::RegSlot dstRegSlot, Js::RegSlot srcRegSlot, Js::RegSlot countRegSlot);
     bool                    RegIsSimd128ReturnVar(Js::RegSlot reg);
     SymID                   GetMappedTemp(Js::RegSlot reg);
     void                    SetMappedTemp(Js::RegSlot reg, SymID tempId);
@@ -81,6 +81,9 @@ HELPERCALL(Op_Rem_Double, Js::NumberUtilities::Modulus, 0)
 #ifdef ENABLE_WASM
 HELPERCALL(Op_CheckWasmSignature, Js::WebAssembly::CheckSignature, AttrCanThrow)
 HELPERCALL(Op_GrowWasmMemory, Js::WebAssemblyMemory::GrowHelper, 0)
+HELPERCALL(Op_CopyWasmMemory, Js::WebAssemblyMemory::CopyHelper, AttrCanThrow)
+HELPERCALL(Op_FillWasmMemory, Js::WebAssemblyMemory::FillHelper, AttrCanThrow)
+HELPERCALL(Op_CopyWasmTable, Js::WebAssemblyTable::CopyHelper, AttrCanThrow)
 #if DBG
 HELPERCALL(Op_WasmMemoryTraceWrite, Js::WebAssemblyMemory::TraceMemWrite, 0)
 #endif
@@ -1735,6 +1735,15 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
         case Js::OpCode::GrowWasmMemory:
             instrPrev = this->LowerGrowWasmMemory(instr);
             break;
+        case Js::OpCode::CopyWasmMemory:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_CopyWasmMemory);
+            break;
+        case Js::OpCode::FillWasmMemory:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_FillWasmMemory);
+            break;
+        case Js::OpCode::CopyWasmTable:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_CopyWasmTable);
+            break;
 #endif
         case Js::OpCode::Ld_I4:
             LowererMD::ChangeToAssign(instr);
@@ -8322,6 +8331,51 @@ Lowerer::LowerGrowWasmMemory(IR::Instr* instr)
 
     return instrPrev;
 }
+
+/*
+    Lower the bulk memory opcodes. IRBuilder generated:
+    (dst)arg1: ExtendArg_A (src1)dst
+    (dst)arg2: ExtendArg_A (src1)src (src2)arg1
+    (dst)arg3: ExtendArg_A (src1)count (src2)arg2
+    CopyWasmMemory (src1)memory (src2)arg3
+
+    We'll convert it to a helper call, the helper checks the bounds once and does the memmove/memset:
+    CALL Helper memory, dst, src, count
+*/
+IR::Instr *
+Lowerer::LowerWasmBulkMemory(IR::Instr* instr, IR::JnHelperMethod helperMethod)
+{
+    IR::Instr * instrPrev = nullptr;
+    IR::Opnd * linkOpnd = instr->GetSrc2();
+
+    // The helper arguments are loaded last to first, which is the order of the chain
+    while (linkOpnd)
+    {
+        Assert(linkOpnd->IsRegOpnd());
+        IR::Instr * argInstr = linkOpnd->AsRegOpnd()->m_sym->m_instrDef;
+        Assert(argInstr->m_opcode == Js::OpCode::ExtendArg_A);
+
+        IR::Opnd * argOpnd = argInstr->GetSrc1();
+        Assert(argOpnd->IsRegOpnd());
+        // If the Extended_arg was CSE's across a loop or hoisted out of a loop,
+        // adding a new reference down here might cause the arg to now be liveOnBackEdge.
+        // We'll clear it once we reach the Extended arg.
+        this->addToLiveOnBackEdgeSyms->Set(argOpnd->AsRegOpnd()->m_sym->m_id);
+        IR::Instr * argLoadInstr = m_lowererMD.LoadHelperArgument(instr, argOpnd->Copy(m_func));
+        if (!instrPrev)
+        {
+            instrPrev = argLoadInstr;
+        }
+
+        linkOpnd = argInstr->GetSrc2();
+    }
+    instr->FreeSrc2();
+
+    m_lowererMD.LoadHelperArgument(instr, instr->UnlinkSrc1());
+    m_lowererMD.ChangeToHelperCall(instr, helperMethod);
+
+    return instrPrev;
+}
 #endif
 
 IR::Instr *
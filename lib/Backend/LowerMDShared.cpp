@@ -1655,8 +1655,13 @@ LowererMD::Legalize(IR::Instr *const instr, bool fPostRegAlloc)
         case Js::OpCode::PCMPGTD:
         case Js::OpCode::PMAXSW:
         case Js::OpCode::PMAXUB:
+        case Js::OpCode::PMAXUD:
+        case Js::OpCode::PMAXUW:
         case Js::OpCode::PMINSW:
         case Js::OpCode::PMINUB:
+        case Js::OpCode::PMINUD:
+        case Js::OpCode::PMINUW:
+        case Js::OpCode::PMULLD:
         case Js::OpCode::PMULLW:
         case Js::OpCode::PMULUDQ:
         case Js::OpCode::POR:
@@ -337,6 +337,7 @@ class LowererMD
     IR::Instr*          Simd128LowerNotEqual(IR::Instr* instr);
     IR::Instr*          Simd128LowerLessThan(IR::Instr* instr);
     IR::Instr*          Simd128LowerLessThanOrEqual(IR::Instr* instr);
+    IR::Instr*          Simd128LowerUnsignedCompare(IR::Instr* instr, Js::OpCode minMaxOpcode, Js::OpCode eqpOpcode, bool negate);
     IR::Instr*          Simd128LowerGreaterThanOrEqual(IR::Instr* instr);
     IR::Instr*          Simd128LowerMinMax_F4(IR::Instr* instr);
     IR::Instr*          Simd128LowerAnyTrue(IR::Instr* instr);
@@ -630,6 +630,7 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
 {
     IR::Opnd* dst, *src1, *src2;
     Js::OpCode movOpcode = Js::OpCode::MOVSS;
+    Js::OpCode extractOpcode = Js::OpCode::InvalidOpCode;
     uint laneWidth = 0, laneIndex = 0, shamt = 0, mask = 0;
     IRType laneType = TyInt32;
     dst = instr->GetDst();
@@ -667,16 +668,26 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
     case Js::OpCode::Simd128_ExtractLane_B16:
         movOpcode = Js::OpCode::MOVD;
         Assert(laneIndex < 16);
-        shamt = (laneIndex % 4) * 8;
-        laneIndex = laneIndex / 4;
         laneType = TyInt8;
         mask = 0x000000ff;
+        if (AutoSystemInfo::Data.SSE4_1Available())
+        {
+            // PEXTRB zero-extends the byte lane, no shift needed
+            extractOpcode = Js::OpCode::PEXTRB;
+            break;
+        }
+        shamt = (laneIndex % 4) * 8;
+        laneIndex = laneIndex / 4;
         break;
     case Js::OpCode::Simd128_ExtractLane_U4:
     case Js::OpCode::Simd128_ExtractLane_I4:
     case Js::OpCode::Simd128_ExtractLane_B4:
         movOpcode = Js::OpCode::MOVD;
         Assert(laneIndex < 4);
+        if (laneIndex != 0 && AutoSystemInfo::Data.SSE4_1Available())
+        {
+            extractOpcode = Js::OpCode::PEXTRD;
+        }
         break;
     default:
         Assert(UNREACHED);
@@ -686,6 +697,11 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
     {
         EmitExtractInt64(dst, instr->GetSrc1(), laneIndex, instr);
     }
+    else if (extractOpcode != Js::OpCode::InvalidOpCode)
+    {
+        // PEXTRD/PEXTRB dst, src1, laneIndex
+        instr->InsertBefore(IR::Instr::New(extractOpcode, dst, src1, IR::IntConstOpnd::New(laneIndex, TyInt8, m_func, true), m_func));
+    }
     else
     {
         IR::Opnd* tmp = src1;
@@ -732,13 +748,16 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
                 newInstr = IR::Instr::New(Js::OpCode::MOVSXW, dst, dst->UseWithNewType(laneType, m_func), m_func);
             }
         }
-        else
+        else if (extractOpcode != Js::OpCode::PEXTRB)
         {
             newInstr = IR::Instr::New(Js::OpCode::AND, dst, dst, IR::IntConstOpnd::New(mask, TyInt32, m_func), m_func);
         }
 
-        instr->InsertBefore(newInstr);
-        Legalize(newInstr);
+        if (newInstr)
+        {
+            instr->InsertBefore(newInstr);
+            Legalize(newInstr);
+        }
     }
     if (instr->m_opcode == Js::OpCode::Simd128_ExtractLane_B4 || instr->m_opcode == Js::OpCode::Simd128_ExtractLane_B8 ||
         instr->m_opcode == Js::OpCode::Simd128_ExtractLane_B16)
@@ -988,6 +1007,18 @@ IR::Instr* LowererMD::Simd128LowerMulI4(IR::Instr *instr)
     Assert(src1->IsRegOpnd() && src1->IsSimd128());
     Assert(src2->IsRegOpnd() && src2->IsSimd128());
 
+    if (AutoSystemInfo::Data.SSE4_1Available())
+    {
+        // dst = PMULLD src1, src2
+        pInstr = IR::Instr::New(Js::OpCode::PMULLD, dst, src1, src2, m_func);
+        instr->InsertBefore(pInstr);
+        Legalize(pInstr);
+
+        pInstr = instr->m_prev;
+        instr->Remove();
+        return pInstr;
+    }
+
     temp1 = IR::RegOpnd::New(src1->GetType(), m_func);
     temp2 = IR::RegOpnd::New(src1->GetType(), m_func);
     temp3 = IR::RegOpnd::New(src1->GetType(), m_func);
@@ -1355,6 +1386,29 @@ IR::Instr* LowererMD::SIMD128LowerReplaceLane_16(IR::Instr* instr)
     lane = src2->AsIntConstOpnd()->AsInt32();
     Assert(lane >= 0 && lane < 16);
 
+    Assert(instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_I16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_U16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_B16);
+    if (AutoSystemInfo::Data.SSE4_1Available())
+    {
+        IR::Opnd* laneValue = EnregisterIntConst(instr, src3);
+
+        // MOVAPS dst, src1
+        newInstr = IR::Instr::New(Js::OpCode::MOVAPS, dst, src1, m_func);
+        instr->InsertBefore(newInstr);
+        Legalize(newInstr);
+
+        // PINSRB dst, value, index
+        instr->InsertBefore(IR::Instr::New(Js::OpCode::PINSRB, dst, laneValue, IR::IntConstOpnd::New(lane, TyInt8, m_func, true), m_func));
+
+        if (instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_B16)  //canonicalizing lanes.
+        {
+            instr = Simd128CanonicalizeToBools(instr, Js::OpCode::PCMPEQB, *dst);
+        }
+
+        IR::Instr* prevInstr = instr->m_prev;
+        instr->Remove();
+        return prevInstr;
+    }
+
     IR::Opnd* laneValue = EnregisterIntConst(instr, src3, TyInt8);
     intptr_t tempSIMD = m_func->GetThreadContextInfo()->GetSimdTempAreaAddr(0);
 #if DBG
@@ -1362,7 +1416,6 @@ IR::Instr* LowererMD::SIMD128LowerReplaceLane_16(IR::Instr* instr)
     intptr_t endAddrSIMD = tempSIMD + sizeof(X86SIMDValue);
 #endif
 
-    Assert(instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_I16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_U16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_B16);
     // MOVUPS [temp], src1
     intptr_t address = tempSIMD;
     newInstr = IR::Instr::New(Js::OpCode::MOVUPS, IR::MemRefOpnd::New(address, TySimd128I16, m_func), src1, m_func);
@@ -1427,41 +1480,50 @@ IR::Instr* LowererMD::SIMD128LowerReplaceLane_4(IR::Instr* instr)
     // MOVAPS dst, src1
     instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVAPS, dst, src1, m_func));
 
-    if (laneValue->GetType() == TyInt32 || laneValue->GetType() == TyUint32)
-    {
-        IR::RegOpnd *tempReg = IR::RegOpnd::New(TyFloat32, m_func);//mov intval to xmm
-                                                                    //MOVD
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVD, tempReg, laneValue, m_func));
-        laneValue = tempReg;
-    }
-    Assert(laneValue->GetType() == TyFloat32);
-    if (lane == 0)
+    bool isIntLane = laneValue->GetType() == TyInt32 || laneValue->GetType() == TyUint32;
+    if (isIntLane && lane != 0 && AutoSystemInfo::Data.SSE4_1Available())
     {
-        // MOVSS for both TyFloat32 and TyInt32. MOVD zeroes upper bits.
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVSS, dst, laneValue, m_func));
-    }
-    else if (lane == 2)
-    {
-        IR::RegOpnd *tmp = IR::RegOpnd::New(type, m_func);
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVHLPS, tmp, dst, m_func));
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVSS, tmp, laneValue, m_func));
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVLHPS, dst, tmp, m_func));
+        // PINSRD dst, value, index
+        instr->InsertBefore(IR::Instr::New(Js::OpCode::PINSRD, dst, laneValue, IR::IntConstOpnd::New(lane, TyInt8, m_func, true), m_func));
     }
     else
     {
-        Assert(lane == 1 || lane == 3);
-        uint8 shufMask = 0xE4; // 11 10 01 00
-        shufMask |= lane;      // 11 10 01 id
-        shufMask &= ~(0x03 << (lane << 1)); // set 2 bits corresponding to lane index to 00
+        if (isIntLane)
+        {
+            IR::RegOpnd *tempReg = IR::RegOpnd::New(TyFloat32, m_func);//mov intval to xmm
+                                                                        //MOVD
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVD, tempReg, laneValue, m_func));
+            laneValue = tempReg;
+        }
+        Assert(laneValue->GetType() == TyFloat32);
+        if (lane == 0)
+        {
+            // MOVSS for both TyFloat32 and TyInt32. MOVD zeroes upper bits.
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVSS, dst, laneValue, m_func));
+        }
+        else if (lane == 2)
+        {
+            IR::RegOpnd *tmp = IR::RegOpnd::New(type, m_func);
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVHLPS, tmp, dst, m_func));
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVSS, tmp, laneValue, m_func));
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVLHPS, dst, tmp, m_func));
+        }
+        else
+        {
+            Assert(lane == 1 || lane == 3);
+            uint8 shufMask = 0xE4; // 11 10 01 00
+            shufMask |= lane;      // 11 10 01 id
+            shufMask &= ~(0x03 << (lane << 1)); // set 2 bits corresponding to lane index to 00
 
-                                            // SHUFPS dst, dst, shufMask
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::SHUFPS, dst, dst, IR::IntConstOpnd::New(shufMask, TyInt8, m_func, true), m_func));
+                                                // SHUFPS dst, dst, shufMask
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::SHUFPS, dst, dst, IR::IntConstOpnd::New(shufMask, TyInt8, m_func, true), m_func));
 
-        // MOVSS dst, value
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVSS, dst, laneValue, m_func));
+            // MOVSS dst, value
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::MOVSS, dst, laneValue, m_func));
 
-        // SHUFPS dst, dst, shufMask
-        instr->InsertBefore(IR::Instr::New(Js::OpCode::SHUFPS, dst, dst, IR::IntConstOpnd::New(shufMask, TyInt8, m_func, true), m_func));
+            // SHUFPS dst, dst, shufMask
+            instr->InsertBefore(IR::Instr::New(Js::OpCode::SHUFPS, dst, dst, IR::IntConstOpnd::New(shufMask, TyInt8, m_func, true), m_func));
+        }
     }
     if (instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_B4) //Canonicalizing lanes
     {
@@ -1853,17 +1915,30 @@ IR::Instr* LowererMD::Simd128LowerLessThan(IR::Instr* instr)
     IR::RegOpnd * mask = IR::RegOpnd::New(TySimd128I4, m_func);
 
     Js::OpCode cmpOpcode = Js::OpCode::PCMPGTD;
+    Js::OpCode eqpOpcode = Js::OpCode::PCMPEQD;
+    Js::OpCode maxOpcode = Js::OpCode::PMAXUD;
     if (instr->m_opcode == Js::OpCode::Simd128_Lt_U8 || instr->m_opcode == Js::OpCode::Simd128_GtEq_U8)
     {
         cmpOpcode = Js::OpCode::PCMPGTW;
+        eqpOpcode = Js::OpCode::PCMPEQW;
+        maxOpcode = Js::OpCode::PMAXUW;
         signBits = IR::MemRefOpnd::New(m_func->GetThreadContextInfo()->GetX86WordSignBitsAddr(), TySimd128I4, m_func);
     }
     else if (instr->m_opcode == Js::OpCode::Simd128_Lt_U16 || instr->m_opcode == Js::OpCode::Simd128_GtEq_U16)
     {
         cmpOpcode = Js::OpCode::PCMPGTB;
+        eqpOpcode = Js::OpCode::PCMPEQB;
+        maxOpcode = Js::OpCode::PMAXUB;
         signBits = IR::MemRefOpnd::New(m_func->GetThreadContextInfo()->GetX86ByteSignBitsAddr(), TySimd128I4, m_func);
     }
 
+    // PMAXUB is SSE2, the word and dword forms need SSE4.1
+    if (maxOpcode == Js::OpCode::PMAXUB || AutoSystemInfo::Data.SSE4_1Available())
+    {
+        bool isLessThan = instr->m_opcode == Js::OpCode::Simd128_Lt_U4 || instr->m_opcode == Js::OpCode::Simd128_Lt_U8 || instr->m_opcode == Js::OpCode::Simd128_Lt_U16;
+        return Simd128LowerUnsignedCompare(instr, maxOpcode, eqpOpcode, isLessThan);
+    }
+
     // MOVUPS mask, [signBits]
     pInstr = IR::Instr::New(Js::OpCode::MOVUPS, mask, signBits, m_func);
     instr->InsertBefore(pInstr);
@@ -1919,15 +1994,26 @@ IR::Instr* LowererMD::Simd128LowerLessThanOrEqual(IR::Instr* instr)
 
     Js::OpCode cmpOpcode = Js::OpCode::PCMPGTD;
     Js::OpCode eqpOpcode = Js::OpCode::PCMPEQD;
+    Js::OpCode minOpcode = Js::OpCode::PMINUD;
     if (instr->m_opcode == Js::OpCode::Simd128_LtEq_I8 || instr->m_opcode == Js::OpCode::Simd128_LtEq_U8 || instr->m_opcode == Js::OpCode::Simd128_Gt_U8)
     {
         cmpOpcode = Js::OpCode::PCMPGTW;
         eqpOpcode = Js::OpCode::PCMPEQW;
+        minOpcode = Js::OpCode::PMINUW;
     }
     else if (instr->m_opcode == Js::OpCode::Simd128_LtEq_I16 || instr->m_opcode == Js::OpCode::Simd128_LtEq_U16 || instr->m_opcode == Js::OpCode::Simd128_Gt_U16)
     {
         cmpOpcode = Js::OpCode::PCMPGTB;
         eqpOpcode = Js::OpCode::PCMPEQB;
+        minOpcode = Js::OpCode::PMINUB;
+    }
+
+    bool isGreaterThan = instr->m_opcode == Js::OpCode::Simd128_Gt_U4 || instr->m_opcode == Js::OpCode::Simd128_Gt_U8 || instr->m_opcode == Js::OpCode::Simd128_Gt_U16;
+    bool isUnsigned = isGreaterThan || instr->m_opcode == Js::OpCode::Simd128_LtEq_U4 || instr->m_opcode == Js::OpCode::Simd128_LtEq_U8 || instr->m_opcode == Js::OpCode::Simd128_LtEq_U16;
+    // PMINUB is SSE2, the word and dword forms need SSE4.1
+    if (isUnsigned && (minOpcode == Js::OpCode::PMINUB || AutoSystemInfo::Data.SSE4_1Available()))
+    {
+        return Simd128LowerUnsignedCompare(instr, minOpcode, eqpOpcode, isGreaterThan);
     }
 
     if (instr->m_opcode == Js::OpCode::Simd128_LtEq_I4)
@@ -2017,6 +2103,39 @@ IR::Instr* LowererMD::Simd128LowerLessThanOrEqual(IR::Instr* instr)
     return pInstr;
 }
 
+// Unsigned (a <= b) is (min(a, b) == a) and (a >= b) is (max(a, b) == a), no sign bias needed.
+IR::Instr* LowererMD::Simd128LowerUnsignedCompare(IR::Instr* instr, Js::OpCode minMaxOpcode, Js::OpCode eqpOpcode, bool negate)
+{
+    IR::Instr *pInstr;
+    IR::Opnd* dst = instr->GetDst();
+    IR::Opnd* src1 = instr->GetSrc1();
+    IR::Opnd* src2 = instr->GetSrc2();
+    IR::RegOpnd* tmp = IR::RegOpnd::New(src1->GetType(), m_func);
+
+    // tmp = PMINU/PMAXU src1, src2
+    pInstr = IR::Instr::New(minMaxOpcode, tmp, src1, src2, m_func);
+    instr->InsertBefore(pInstr);
+    Legalize(pInstr);
+
+    // dst = PCMPEQ tmp, src1
+    pInstr = IR::Instr::New(eqpOpcode, dst, tmp, src1, m_func);
+    instr->InsertBefore(pInstr);
+    Legalize(pInstr);
+
+    if (negate)
+    {
+        // dst = PANDN dst, X86_ALL_NEG_ONES
+        pInstr = IR::Instr::New(Js::OpCode::PANDN, dst, dst, IR::MemRefOpnd::New(m_func->GetThreadContextInfo()->GetX86AllNegOnesAddr(), TySimd128I4, m_func), m_func);
+        instr->InsertBefore(pInstr);
+        Legalize(pInstr);
+    }
+
+    pInstr = instr->m_prev;
+    instr->Remove();
+
+    return pInstr;
+}
+
 IR::Instr* LowererMD::Simd128LowerGreaterThanOrEqual(IR::Instr* instr)
 {
     Assert(instr->m_opcode == Js::OpCode::Simd128_GtEq_I4 || instr->m_opcode == Js::OpCode::Simd128_GtEq_I8 || instr->m_opcode == Js::OpCode::Simd128_GtEq_I16);
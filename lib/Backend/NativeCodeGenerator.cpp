@@ -1943,10 +1943,11 @@ NativeCodeGenerator::Prioritize(JsUtil::Job *const job, const bool forceAddJobTo
     {
         // Prioritize full JIT work items over simple JIT work items. This simple solution seems sufficient for now, but it
         // might be better to use a priority queue if it becomes necessary to prioritize recent simple JIT work items relative
-        // to the older simple JIT work items.
+        // to the older simple JIT work items. Baseline simple JIT work items are small enough that they go first anyway, so
+        // warm functions don't wait in the interpreter behind full JIT work.
         AddToJitQueue(
             workItem,
-            jitMode == ExecutionMode::FullJit || queuedFullJitWorkItemCount == 0 /* prioritize */,
+            jitMode == ExecutionMode::FullJit || queuedFullJitWorkItemCount == 0 || functionBody->DoBaselineJit() /* prioritize */,
             false /* lock */,
             function);
     }
@@ -3454,6 +3455,12 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
     AutoOptionalCriticalSection autoLock(lock ? Processor()->GetCriticalSection() : nullptr);
     scriptContext->GetThreadContext()->RegisterCodeGenRecyclableData(recyclableData);
 
+    if(CONFIG_FLAG_RELEASE(JitPriorityScheduling))
+    {
+        UpdateQueuedFullJitWorkItemPriorities();
+        codeGenWorkItem->SetPriority(GetJitPriority(codeGenWorkItem));
+    }
+
     // If we have added a lot of jobs that are still waiting to be jitted, remove the oldest job
     // to ensure we do not spend time jitting stale work items.
     const ExecutionMode jitMode = codeGenWorkItem->GetJitMode();
@@ -3489,6 +3496,40 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
     codeGenWorkItem->OnAddToJitQueue();
 }
 
+uint NativeCodeGenerator::GetJitPriority(CodeGenWorkItem *const codeGenWorkItem) const
+{
+    // This function is called from inside the lock
+
+    // The heat of a work item is how many calls (or loop iterations, for a loop body) the interpreter has seen. Scale it down
+    // by the number of jobs this script context already has queued, so that a busy script context sharing the job processor
+    // with others doesn't keep their hot functions waiting behind its own colder ones.
+    const uint heat = codeGenWorkItem->GetInterpretedCount();
+    return heat / (NumJobsAddedToProcessor() + 1);
+}
+
+void NativeCodeGenerator::UpdateQueuedFullJitWorkItemPriorities()
+{
+    // This function is called from inside the lock
+
+    // Functions keep running in the interpreter while they wait for the full JIT. Move the ones that got hotter ahead in the
+    // job processor's queue, and to the front of queuedFullJitWorkItems so that the coldest work item is the one removed when
+    // the queue grows past JitQueueThreshold.
+    QueuedFullJitWorkItem *nextQueuedFullJitWorkItem;
+    for(QueuedFullJitWorkItem *queuedFullJitWorkItem = queuedFullJitWorkItems.Head();
+        queuedFullJitWorkItem;
+        queuedFullJitWorkItem = nextQueuedFullJitWorkItem)
+    {
+        nextQueuedFullJitWorkItem = queuedFullJitWorkItem->Next();
+
+        CodeGenWorkItem *const workItem = queuedFullJitWorkItem->WorkItem();
+        const uint priority = GetJitPriority(workItem);
+        if(priority > workItem->Priority() && Processor()->UpdateJobPriority(workItem, priority))
+        {
+            queuedFullJitWorkItems.MoveToBeginning(queuedFullJitWorkItem);
+        }
+    }
+}
+
 void NativeCodeGenerator::AddWorkItem(CodeGenWorkItem* workitem)
 {
     workitem->ResetJitMode();
@@ -80,6 +80,8 @@ void SetProfileMode(BOOL fSet);
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
     JsUtil::Job *GetJobToProcessProactively();
     void AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function = nullptr);
+    uint GetJitPriority(CodeGenWorkItem *const codeGenWorkItem) const;
+    void UpdateQueuedFullJitWorkItemPriorities();
     void RemoveProactiveJobs();
     void UpdateJITState();
     static void LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time);
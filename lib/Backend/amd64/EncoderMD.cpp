@@ -708,7 +708,7 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
     else if (opdope & D66)
     {
         Assert((opdope & (D66 | DF2 | DF3)) == D66);
-        Assert(leadIn == OLB_0F || leadIn == OLB_0F3A);
+        Assert(leadIn == OLB_0F || leadIn == OLB_0F38 || leadIn == OLB_0F3A);
         *instrRestart++ = 0x66;
     }
     else if (opdope & DF2)
@@ -742,6 +742,10 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
     case OLB_0F:
         *instrRestart++ = 0x0f;
         break;
+    case OLB_0F38:
+        *instrRestart++ = 0x0f;
+        *instrRestart++ = 0x38;
+        break;
     case OLB_0F3A:
         *instrRestart++ = 0x0f;
         *instrRestart++ = 0x3a;
@@ -980,6 +984,7 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
                 }
                 break;
             }
+            case Js::OpCode::PEXTRB:
             case Js::OpCode::PEXTRD:
             case Js::OpCode::PEXTRQ:
                 this->EmitModRM(instr, opr1, this->GetRegEncode(opr2->AsRegOpnd()));
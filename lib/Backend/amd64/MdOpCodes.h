@@ -185,15 +185,21 @@ MACRO(PCMPGTD,  Reg2,   None,           RNON,   f(MODRM),   o(PCMPGTD), DNO16|DO
 MACRO(PCMPGTW,  Reg2,   None,           RNON,   f(MODRM),   o(PCMPGTW), DNO16|DOPEQ|D66,            OLB_0F)
 MACRO(PMAXSW,   Reg2,   None,           RNON,   f(MODRM),   o(PMAXSW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PMAXUB,   Reg2,   None,           RNON,   f(MODRM),   o(PMAXUB),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
+MACRO(PMAXUD,   Reg2,   None,           RNON,   f(MODRM),   o(PMAXUD),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
+MACRO(PMAXUW,   Reg2,   None,           RNON,   f(MODRM),   o(PMAXUW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
 MACRO(PMINSW,   Reg2,   None,           RNON,   f(MODRM),   o(PMINSW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PMINUB,   Reg2,   None,           RNON,   f(MODRM),   o(PMINUB),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
+MACRO(PMINUD,   Reg2,   None,           RNON,   f(MODRM),   o(PMINUD),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
+MACRO(PMINUW,   Reg2,   None,           RNON,   f(MODRM),   o(PMINUW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
 
+MACRO(PMULLD,   Reg2,   None,           RNON,   f(MODRM),   o(PMULLD),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
 MACRO(PMULLW,   Reg2,   None,           RNON,   f(MODRM),   o(PMULLW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PMULUDQ,  Reg2,   None,           RNON,   f(MODRM),   o(PMULUDQ), DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(POR,      Reg2,   None,           RNON,   f(MODRM),   o(POR),     DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F)
 MACRO(PSHUFD,   Reg3,   None,           RNON,   f(MODRM),   o(PSHUFD),  DDST|DNO16|D66|DSSE,        OLB_0F)
 
 MACRO(PEXTRW,   Reg3,   None,           RNON,   f(MODRM),   o(PEXTRW),  DDST|DNO16|D66|DSSE,        OLB_0F)
+MACRO(PEXTRB,   Reg3,   None,           RNON,   f(SPECIAL), o(PEXTRB),  DDST|DNO16|DSSE|D66,        OLB_0F3A)
 MACRO(PEXTRD,   Reg3,   None,           RNON,   f(SPECIAL), o(PEXTRD),  DDST|DNO16|DSSE|D66,        OLB_0F3A)
 MACRO(PEXTRQ,   Reg3,   None,           RNON,   f(SPECIAL), o(PEXTRQ),  DDST|DNO16|D66|DREXSRC|DSSE,OLB_0F3A)
 MACRO(PSLLDQ,   Reg2,   None,           R111,   f(SPECIAL), o(PSLLDQ),  DDST|DNO16|DOPEQ|D66|DSSE,  OLB_0F)
@@ -267,6 +273,7 @@ MACRO(XCHG,     Reg2,   None,          R000,   f(XCHG),    o(XCHG),    DOPEQ,
 MACRO(XOR,      Reg2,   OpSideEffect,  R110,   f(BINOP),   o(XOR),     DOPEQ|DSETCC|DCOMMOP,        OLB_NONE)
 MACRO(XORPS,    Reg3,   None,          RNON,   f(MODRM),   o(XORPS),   DNO16|DOPEQ|DCOMMOP,         OLB_0F)
 MACRO(PINSRW,   Reg2,   None,          RNON,   f(MODRM),   o(PINSRW),  DDST|DNO16|DSSE|D66,         OLB_0F)
+MACRO(PINSRB,   Reg3,   None,          RNON,   f(MODRM),   o(PINSRB),  DDST|DNO16|DSSE|D66,        OLB_0F3A)
 MACRO(PINSRD,   Reg3,   None,          RNON,   f(MODRM),   o(PINSRD),  DDST|DNO16|DSSE|D66,        OLB_0F3A)
 MACRO(PINSRQ,   Reg3,   None,          RNON,   f(MODRM),   o(PINSRQ),  DDST|DNO16|D66|DREXSRC|DSSE,OLB_0F3A)
 MACRO(POPCNT,   Reg2,   None,          RNON,   f(MODRM),   o(POPCNT),  DF3|DSETCC|DDST,             OLB_0F)
@@ -95,7 +95,7 @@
 #define OLB_NONE 0x0    // opcode is one byte: no lead-in bytes
 #define OLB_0F   0x1    // opcode is 0F xx or VEX.mmmmm = 00001
 //#define OLB_0F01 0x2    // opcode is 0F 01 xx (no VEX encoding)
-//#define OLB_0F38 0x3    // opcode is 0F 38 xx or VEX.mmmmm = 00010
+#define OLB_0F38 0x3    // opcode is 0F 38 xx or VEX.mmmmm = 00010
 #define OLB_0F3A 0x4    // opcode is 0F 3A xx or VEX.mmmmm = 00011
 //#define OLB_XOP8 0x8    // XOP prefix with mmmmm = 01000
 //#define OLB_XOP9 0x9    // XOP prefix with mmmmm = 01001
@@ -281,11 +281,16 @@ enum Forms : BYTE
 #define OPBYTE_PCMPGTW  {0x65}                  // modrm
 #define OPBYTE_PMAXSW   {0xee}                  // modrm
 #define OPBYTE_PMAXUB   {0xde}                  // modrm
+#define OPBYTE_PMAXUD   {0x3f}                  // modrm
+#define OPBYTE_PMAXUW   {0x3e}                  // modrm
 #define OPBYTE_PMINSW   {0xea}                  // modrm
 #define OPBYTE_PMINUB   {0xda}                  // modrm
+#define OPBYTE_PMINUD   {0x3b}                  // modrm
+#define OPBYTE_PMINUW   {0x3a}                  // modrm
 #define OPBYTE_PMOVMSKB {0xd7}                  // modrm
 #define OPBYTE_PMULLW   {0xd5}                  // modrm
 #define OPBYTE_PMULUDQ  {0xf4}                  // modrm
+#define OPBYTE_PMULLD   {0x40}                  // modrm
 #define OPBYTE_PMULLW   {0xd5}                  // modrm
 
 #define OPBYTE_POP      {0x58, 0, 0x8f}          // pshpop, byte2=0 immed not legal
@@ -294,9 +299,11 @@ enum Forms : BYTE
 #define OPBYTE_POPCNT   {0xB8}                  // modrm
 #define OPBYTE_PSHUFD   {0x70}                  // special
 #define OPBYTE_PEXTRW   {0xc5}                  // special
+#define OPBYTE_PEXTRB   {0x14}                  // special
 #define OPBYTE_PEXTRD   {0x16}                  // special
 #define OPBYTE_PEXTRQ   {0x16}                  // special
 #define OPBYTE_PINSRW   {0xc4}                  // special
+#define OPBYTE_PINSRB   {0x20}                  // special
 #define OPBYTE_PINSRD   {0x22}                  // special
 #define OPBYTE_PINSRQ   {0x22}                  // special
 #define OPBYTE_PSLLDQ   {0x73}                  // mmxshift
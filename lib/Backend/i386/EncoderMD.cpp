@@ -689,6 +689,10 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
         case OLB_NONE:
             break;
 
+        case OLB_0F38:
+            *instrRestart++ = 0x38;
+            break;
+
         case OLB_0F3A:
             *instrRestart++ = 0x3a;
             break;
@@ -1138,6 +1142,7 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
                     continue;
                 }
                 break;
+            case Js::OpCode::PEXTRB:
             case Js::OpCode::PEXTRD:
                 this->EmitModRM(instr, opr1, this->GetRegEncode(opr2->AsRegOpnd()));
                 break;
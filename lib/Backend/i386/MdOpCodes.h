@@ -174,8 +174,13 @@ MACRO(PCMPGTD,  Reg2,       None,           RNON,   f(MODRM),   o(PCMPGTD), DNO1
 MACRO(PCMPGTW,  Reg2,       None,           RNON,   f(MODRM),   o(PCMPGTW), DNO16|DOPEQ|D66,            OLB_NONE)
 MACRO(PMAXSW,   Reg2,       None,           RNON,   f(MODRM),   o(PMAXSW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_NONE)
 MACRO(PMAXUB,   Reg2,       None,           RNON,   f(MODRM),   o(PMAXUB),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_NONE)
+MACRO(PMAXUD,   Reg2,       None,           RNON,   f(MODRM),   o(PMAXUD),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
+MACRO(PMAXUW,   Reg2,       None,           RNON,   f(MODRM),   o(PMAXUW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
 MACRO(PMINSW,   Reg2,       None,           RNON,   f(MODRM),   o(PMINSW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_NONE)
 MACRO(PMINUB,   Reg2,       None,           RNON,   f(MODRM),   o(PMINUB),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_NONE)
+MACRO(PMINUD,   Reg2,       None,           RNON,   f(MODRM),   o(PMINUD),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
+MACRO(PMINUW,   Reg2,       None,           RNON,   f(MODRM),   o(PMINUW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
+MACRO(PMULLD,   Reg2,       None,           RNON,   f(MODRM),   o(PMULLD),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_0F38)
 MACRO(PMULLW,   Reg2,       None,           RNON,   f(MODRM),   o(PMULLW),  DNO16|DOPEQ|D66|DCOMMOP,    OLB_NONE)
 MACRO(PMULUDQ,  Reg2,       None,           RNON,   f(MODRM),   o(PMULUDQ), DNO16|DOPEQ|D66|DCOMMOP,    OLB_NONE)
 
@@ -184,8 +189,10 @@ MACRO(POP,      Reg1,       OpSideEffect,   R000,   f(PSHPOP),  o(POP),     DDST
 MACRO(POR,      Reg2,       None,           RNON,   f(MODRM),   o(POR),     DNO16|DOPEQ|D66|DCOMMOP,    OLB_NONE)
 MACRO(PSHUFD,   Reg3,       None,           RNON,   f(MODRM),   o(PSHUFD),  DDST|DNO16|D66|DSSE,        OLB_NONE)
 MACRO(PEXTRW,   Reg3,       None,           RNON,   f(MODRM),   o(PEXTRW),  DDST|DNO16|D66|DSSE,        OLB_NONE)
+MACRO(PEXTRB,   Reg3,       None,           RNON,   f(SPECIAL), o(PEXTRB),  DDST|DNO16|DSSE|D66,        OLB_0F3A)
 MACRO(PEXTRD,   Reg3,       None,           RNON,   f(SPECIAL), o(PEXTRD),  DDST|DNO16|DSSE|D66,        OLB_0F3A)
 MACRO(PINSRW,   Reg3,       None,           RNON,   f(MODRM),   o(PINSRW),  DDST|DNO16|D66|DSSE,        OLB_NONE)
+MACRO(PINSRB,   Reg3,       None,           RNON,   f(MODRM),   o(PINSRB),  DDST|DNO16|D66|DSSE,        OLB_0F3A)
 MACRO(PINSRD,   Reg3,       None,           RNON,   f(MODRM),   o(PINSRD),  DDST|DNO16|D66|DSSE,        OLB_0F3A)
 MACRO(PSLLDQ,   Reg2,       None,           R111,   f(SPECIAL), o(PSLLDQ),  DDST|DNO16|DOPEQ|D66|DSSE,  OLB_NONE)
 MACRO(PSRLDQ,   Reg2,       None,           R011,   f(SPECIAL), o(PSRLDQ),  DDST|DNO16|DOPEQ|D66|DSSE,  OLB_NONE)
@@ -2,6 +2,22 @@
 // Copyright (C) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
+// Runs of ASCII are converted with SSE2, which every x86 target we build for has, or with AVX2
+// when the processor and OS support it. The intrinsic headers are included ahead of the PAL.
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define UTF8_CODEX_SIMD 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#define UTF8_CODEX_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define UTF8_CODEX_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+#else
+#define UTF8_CODEX_SIMD 0
+#endif
+
 #include "Utf8Codex.h"
 
 #ifndef _WIN32
@@ -38,6 +54,210 @@ namespace utf8
         return (reinterpret_cast<size_t>(pb) & mAlignmentMask) == 0 && (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
     }
 
+#if UTF8_CODEX_SIMD
+    // The vector routines only process whole blocks and stop at the first block containing a
+    // non-ASCII unit, returning the number of units processed; the callers finish the run one
+    // unit at a time.
+
+    static size_t AsciiBlocksLengthSse2(LPCUTF8 pch, size_t cb)
+    {
+        size_t i = 0;
+        for (; i + 16 <= cb; i += 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pch + i));
+            if (_mm_movemask_epi8(bytes) != 0) break;
+        }
+        return i;
+    }
+
+    static size_t WidenAsciiBlocksSse2(char16 *buffer, LPCUTF8 pch, size_t cb)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= cb; i += 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pch + i));
+            if (_mm_movemask_epi8(bytes) != 0) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        }
+        return i;
+    }
+
+    static size_t NarrowAsciiBlocksSse2(LPUTF8 buffer, const char16 *source, size_t cch)
+    {
+        const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= cch; i += 16)
+        {
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i + 8));
+            __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiMask);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(buffer + i), _mm_packus_epi16(low, high));
+        }
+        return i;
+    }
+
+    UTF8_CODEX_TARGET_AVX2
+    static size_t AsciiBlocksLengthAvx2(LPCUTF8 pch, size_t cb)
+    {
+        size_t i = 0;
+        for (; i + 32 <= cb; i += 32)
+        {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pch + i));
+            if (_mm256_movemask_epi8(bytes) != 0) break;
+        }
+        return i;
+    }
+
+    UTF8_CODEX_TARGET_AVX2
+    static size_t WidenAsciiBlocksAvx2(char16 *buffer, LPCUTF8 pch, size_t cb)
+    {
+        size_t i = 0;
+        for (; i + 32 <= cb; i += 32)
+        {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pch + i));
+            if (_mm256_movemask_epi8(bytes) != 0) break;
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(buffer + i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(buffer + i + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+        }
+        return i;
+    }
+
+    UTF8_CODEX_TARGET_AVX2
+    static size_t NarrowAsciiBlocksAvx2(LPUTF8 buffer, const char16 *source, size_t cch)
+    {
+        const __m256i nonAsciiMask = _mm256_set1_epi16(static_cast<short>(0xFF80));
+        size_t i = 0;
+        for (; i + 32 <= cch; i += 32)
+        {
+            __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i + 16));
+            if (!_mm256_testz_si256(_mm256_or_si256(low, high), nonAsciiMask)) break;
+
+            // packus works within 128-bit lanes, so put the 64-bit quarters back in order
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(buffer + i), packed);
+        }
+        return i;
+    }
+
+    static bool IsAvx2Available()
+    {
+#ifdef _MSC_VER
+        int cpuInfo[4];
+        __cpuid(cpuInfo, 0);
+        if (cpuInfo[0] < 7)
+        {
+            return false;
+        }
+        __cpuid(cpuInfo, 1);
+        const int osxsaveAndAvx = (1 << 27) | (1 << 28);
+        if ((cpuInfo[2] & osxsaveAndAvx) != osxsaveAndAvx || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+        __cpuidex(cpuInfo, 7, 0);
+        return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+        unsigned int eax, ebx, ecx, edx;
+        if (__get_cpuid_max(0, nullptr) < 7)
+        {
+            return false;
+        }
+        __cpuid(1, eax, ebx, ecx, edx);
+        const unsigned int osxsaveAndAvx = (1 << 27) | (1 << 28);
+        if ((ecx & osxsaveAndAvx) != osxsaveAndAvx)
+        {
+            return false;
+        }
+        // The OS must save the YMM registers on context switch
+        unsigned int xcr0Low, xcr0High;
+        __asm__ ("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+        if ((xcr0Low & 0x6) != 0x6)
+        {
+            return false;
+        }
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        return (ebx & (1 << 5)) != 0;
+#endif
+    }
+
+    struct AsciiBlockRoutines
+    {
+        size_t (*asciiBlocksLength)(LPCUTF8 pch, size_t cb);
+        size_t (*widenAsciiBlocks)(char16 *buffer, LPCUTF8 pch, size_t cb);
+        size_t (*narrowAsciiBlocks)(LPUTF8 buffer, const char16 *source, size_t cch);
+    };
+
+    static AsciiBlockRoutines SelectAsciiBlockRoutines()
+    {
+        if (IsAvx2Available())
+        {
+            AsciiBlockRoutines avx2Routines = { AsciiBlocksLengthAvx2, WidenAsciiBlocksAvx2, NarrowAsciiBlocksAvx2 };
+            return avx2Routines;
+        }
+        AsciiBlockRoutines sse2Routines = { AsciiBlocksLengthSse2, WidenAsciiBlocksSse2, NarrowAsciiBlocksSse2 };
+        return sse2Routines;
+    }
+
+    // Selected on first use rather than by a static initializer, so the routines are ready however early
+    // the codex is first called and the module has no initialization order dependency on this file
+    static const AsciiBlockRoutines& GetAsciiBlockRoutines()
+    {
+        static const AsciiBlockRoutines asciiBlockRoutines = SelectAsciiBlockRoutines();
+        return asciiBlockRoutines;
+    }
+#endif
+
+    _Use_decl_annotations_
+    size_t AsciiPrefixLength(LPCUTF8 pch, size_t cb)
+    {
+#if UTF8_CODEX_SIMD
+        size_t i = GetAsciiBlockRoutines().asciiBlocksLength(pch, cb);
+#else
+        size_t i = 0;
+#endif
+        while (i < cb && pch[i] < 0x80)
+        {
+            i++;
+        }
+        return i;
+    }
+
+    _Use_decl_annotations_
+    size_t WidenAsciiPrefix(char16 *buffer, LPCUTF8 pch, size_t cb)
+    {
+#if UTF8_CODEX_SIMD
+        size_t i = GetAsciiBlockRoutines().widenAsciiBlocks(buffer, pch, cb);
+#else
+        size_t i = 0;
+#endif
+        while (i < cb && pch[i] < 0x80)
+        {
+            buffer[i] = char16(pch[i]);
+            i++;
+        }
+        return i;
+    }
+
+    size_t NarrowAsciiPrefix(__out_ecount(cch) LPUTF8 buffer, __in_ecount(cch) const char16 *source, size_t cch)
+    {
+#if UTF8_CODEX_SIMD
+        size_t i = GetAsciiBlockRoutines().narrowAsciiBlocks(buffer, source, cch);
+#else
+        size_t i = 0;
+#endif
+        while (i < cch && source[i] < 0x80)
+        {
+            buffer[i] = utf8char_t(source[i]);
+            i++;
+        }
+        return i;
+    }
+
     inline size_t EncodedBytes(char16 prefix)
     {
          CodexAssert(0 == (prefix & 0xFF00)); // prefix must really be a byte. We use char16 for as a convenience for the API.
@@ -366,20 +586,13 @@ namespace utf8
         LPCUTF8 p = pbUtf8;
         char16 *dest = buffer;
 
-        if (!ShouldFastPath(p, dest)) goto LSlowPath;
-
-LFastPath:
-        while (p + 3 < pbEnd)
+LAsciiRun:
         {
-            unsigned bytes = *(unsigned *)p;
-            if ((bytes & 0x80808080) != 0) goto LSlowPath;
-            ((uint32 *)dest)[0] = (char16(bytes) & 0x00FF) | ((char16(bytes) & 0xFF00) << 8);
-            ((uint32 *)dest)[1] = (char16(bytes >> 16) & 0x00FF) | ((char16(bytes >> 16) & 0xFF00) << 8);
-            p += 4;
-            dest += 4;
+            size_t asciiCount = WidenAsciiPrefix(dest, p, pbEnd - p);
+            p += asciiCount;
+            dest += asciiCount;
         }
 
-LSlowPath:
         while (p < pbEnd)
         {
             LPCUTF8 s = p;
@@ -396,7 +609,7 @@ namespace utf8
                 break;
             }
 
-            if (ShouldFastPath(p, dest)) goto LFastPath;
+            if (p < pbEnd && *p < 0x80) goto LAsciiRun;
         }
 
         pbUtf8 = p;
@@ -440,7 +653,23 @@ namespace utf8
 
         CodexAssertOrFailFast(dest <= bufferEnd);
 
-        if (!ShouldFastPath(dest, source)) goto LSlowPath;
+        if (countBytesOnly)
+        {
+            if (!ShouldFastPath(dest, source)) goto LSlowPath;
+            goto LFastPath;
+        }
+
+LAsciiRun:
+        if (!countBytesOnly)
+        {
+            // Never write past bufferEnd; the slow path fails fast if the buffer is too small
+            size_t available = static_cast<LPCUTF8>(bufferEnd) - dest;
+            size_t asciiCount = NarrowAsciiPrefix(dest, source, cch < available ? cch : available);
+            dest += asciiCount;
+            source += asciiCount;
+            cch -= static_cast<charcount_t>(asciiCount);
+            goto LSlowPath;
+        }
 
 LFastPath:
         while (cch >= 4)
@@ -467,7 +696,11 @@ namespace utf8
             while (cch-- > 0)
             {
                 dest = Encode<countBytesOnly>(*source++, dest, bufferEnd);
-                if (ShouldFastPath(dest, source)) goto LFastPath;
+                if (!countBytesOnly)
+                {
+                    if (cch > 0 && *source < 0x80) goto LAsciiRun;
+                }
+                else if (ShouldFastPath(dest, source)) goto LFastPath;
             }
         }
         else
@@ -479,7 +712,11 @@ namespace utf8
                 // EncodeTrueUtf8 will consume the low surrogate code unit too by decrementing cch
                 // and incrementing source
                 dest = EncodeTrueUtf8<countBytesOnly>(*source++, &source, &cch, dest, bufferEnd);
-                if (ShouldFastPath(dest, source)) goto LFastPath;
+                if (!countBytesOnly)
+                {
+                    if (cch > 0 && *source < 0x80) goto LAsciiRun;
+                }
+                else if (ShouldFastPath(dest, source)) goto LFastPath;
             }
         }
 
@@ -568,26 +805,16 @@ namespace utf8
         DecodeOptions localOptions = options;
         LPCUTF8 pchCurrent = pch;
         LPCUTF8 pchEnd = pch + cbIndex;
-        LPCUTF8 pchEndMinus4 = pch + (cbIndex - 4);
         charcount_t i = 0;
 
-        // Avoid using a reinterpret_cast to start a misaligned read.
-        if (!IsAligned(pchCurrent)) goto LSlowPath;
-
-LFastPath:
-        // Skip 4 bytes at a time.
-        while (pchCurrent < pchEndMinus4)
+LAsciiRun:
         {
-            uint32 ch4 = *reinterpret_cast<const uint32 *>(pchCurrent);
-            if ((ch4 & 0x80808080) == 0)
-            {
-                pchCurrent += 4;
-                i += 4;
-            }
-            else break;
+            // Each ASCII byte is one character
+            size_t asciiCount = AsciiPrefixLength(pchCurrent, pchEnd - pchCurrent);
+            pchCurrent += asciiCount;
+            i += static_cast<charcount_t>(asciiCount);
         }
 
-LSlowPath:
         while (pchCurrent < pchEnd)
         {
             LPCUTF8 s = pchCurrent;
@@ -595,8 +822,7 @@ namespace utf8
             if (s == pchCurrent) break;
             i++;
 
-            // Try to return to the fast path avoiding misaligned reads.
-            if (IsAligned(pchCurrent)) goto LFastPath;
+            if (pchCurrent < pchEnd && *pchCurrent < 0x80) goto LAsciiRun;
         }
 
         return i;
@@ -385,6 +385,14 @@ namespace utf8
         return PrevCharFull(ptr, start);
     }
 
+    // Return the number of leading bytes of pch that are ASCII (< 0x80)
+    _Ret_range_(0, cb)
+    size_t AsciiPrefixLength(__in_ecount(cb) LPCUTF8 pch, size_t cb);
+
+    // Widen the leading ASCII bytes of pch into buffer, returning the number of characters written
+    _Ret_range_(0, cb)
+    size_t WidenAsciiPrefix(__out_ecount(cb) char16 *buffer, __in_ecount(cb) LPCUTF8 pch, size_t cb);
+
     // Decode cb bytes from ptr to into buffer returning the number of characters converted and written to buffer
     _Ret_range_(0, pbEnd - _Old_(pbUtf8))
     size_t DecodeUnitsInto(_Out_writes_(pbEnd - pbUtf8) char16 *buffer, LPCUTF8& pbUtf8, LPCUTF8 pbEnd, DecodeOptions options = doDefault, bool *chunkEndsAtTruncatedSequence = nullptr);
@@ -109,16 +109,11 @@ namespace utf8
             return E_INVALIDARG;
         }
 
-        for (; sourceStart < sourceCount; sourceStart++)
+        sourceStart = utf8::WidenAsciiPrefix(destString, (LPCUTF8)sourceString, sourceCount);
+        if (sourceStart != sourceCount)
         {
-            const char ch = sourceString[sourceStart];
-            if ( ! (ch > 0 && ch < 0x0080) )
-            {
-                size_t fallback = sourceStart > 3 ? 3 : sourceStart; // 3 + 1 -> fallback at least 1 unicode char
-                sourceStart -= fallback;
-                break;
-            }
-            destString[sourceStart] = (WCHAR) ch;
+            size_t fallback = sourceStart > 3 ? 3 : sourceStart; // 3 + 1 -> fallback at least 1 unicode char
+            sourceStart -= fallback;
         }
 
         if (sourceStart == sourceCount)
@@ -35,14 +35,14 @@ namespace JsUtil
     // Job
     // -------------------------------------------------------------------------------------------------------------------------
 
-    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical)
+    Job::Job(const bool isCritical) : manager(0), isCritical(isCritical), priority(0)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
     {
     }
 
-    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical)
+    Job::Job(JobManager *const manager, const bool isCritical) : manager(manager), isCritical(isCritical), priority(0)
 #if ENABLE_DEBUG_CONFIG_OPTIONS
         , failureReason(FailureReason::NotFailed)
 #endif
@@ -60,6 +60,16 @@ namespace JsUtil
         return isCritical;
     }
 
+    uint Job::Priority() const
+    {
+        return priority;
+    }
+
+    void Job::SetPriority(const uint priority)
+    {
+        this->priority = priority;
+    }
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobManager
     // -------------------------------------------------------------------------------------------------------------------------
@@ -81,6 +91,11 @@ namespace JsUtil
         return processor;
     }
 
+    unsigned int JobManager::NumJobsAddedToProcessor() const
+    {
+        return numJobsAddedToProcessor;
+    }
+
     void JobManager::LastJobProcessed()
     {
     }
@@ -311,10 +326,57 @@ namespace JsUtil
             Js::Throw::OutOfMemory();  // Overflow: job counts we use are int32's.
         ++job->Manager()->numJobsAddedToProcessor;
 
+        LinkJob(job, prioritize);
+    }
+
+    void JobProcessor::LinkJob(Job *const job, const bool prioritize)
+    {
+        // This function is called from inside the lock
+
         if (prioritize)
-            jobs.LinkToBeginning(job);
+        {
+            // Go ahead of all jobs that are not more urgent
+            Job *nextJob = jobs.Head();
+            while (nextJob && nextJob->Priority() > job->Priority())
+            {
+                nextJob = nextJob->Next();
+            }
+
+            if (nextJob)
+                jobs.LinkBefore(job, nextJob);
+            else
+                jobs.LinkToEnd(job);
+        }
         else
-            jobs.LinkToEnd(job);
+        {
+            // Go behind all jobs that are at least as urgent
+            Job *previousJob = jobs.Tail();
+            while (previousJob && previousJob->Priority() < job->Priority())
+            {
+                previousJob = previousJob->Previous();
+            }
+
+            if (previousJob)
+                jobs.LinkAfter(job, previousJob);
+            else
+                jobs.LinkToBeginning(job);
+        }
+    }
+
+    bool JobProcessor::UpdateJobPriority(Job *const job, const uint priority)
+    {
+        // This function is called from inside the lock
+
+        Assert(job);
+        Assert(managers.Contains(job->Manager()));
+        Assert(!IsClosed());
+
+        jobs.Unlink(job);
+        job->SetPriority(priority);
+
+        // The job became more (or less) urgent while it was waiting, so treat it like a newly prioritized job
+        LinkJob(job, true);
+        return true;
     }
 
     bool JobProcessor::RemoveJob(Job *const job)
@@ -484,7 +546,7 @@ namespace JsUtil
     // BackgroundJobProcessor
     // -------------------------------------------------------------------------------------------------------------------------
 
-    void BackgroundJobProcessor::InitializeThreadCount()
+    void BackgroundJobProcessor::InitializeThreadCount(bool isProcessWide)
     {
         if (CONFIG_FLAG(ForceMaxJitThreadCount))
         {
@@ -495,6 +557,21 @@ namespace JsUtil
             // In a low-memory scenario, don't spin up multiple threads, regardless of how many cores we have.
             this->maxThreadCount = 1;
         }
+        else if (isProcessWide && CONFIG_FLAG_RELEASE(SharedJitThreadPool))
+        {
+            // This processor serves all thread contexts in the process, so size it to the machine rather than to one
+            // script thread. Leave room for the UI (main) thread and a GC thread, as below.
+            int sharedThreadCount = CONFIG_FLAG_RELEASE(SharedJitThreadCount);
+            if (sharedThreadCount > 0)
+            {
+                this->maxThreadCount = sharedThreadCount;
+            }
+            else
+            {
+                int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
+                this->maxThreadCount = max(1, processorCount - 2);
+            }
+        }
         else
         {
             int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
@@ -504,11 +581,11 @@ namespace JsUtil
         }
     }
 
-    void BackgroundJobProcessor::InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads)
+    void BackgroundJobProcessor::InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads, bool isProcessWide)
     {
         if (!disableParallelThreads)
         {
-            InitializeThreadCount();
+            InitializeThreadCount(isProcessWide);
         }
         else
         {
@@ -607,7 +684,7 @@ namespace JsUtil
         return;
     }
 
-    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads)
+    BackgroundJobProcessor::BackgroundJobProcessor(AllocationPolicyManager* policyManager, JsUtil::ThreadService *threadService, bool disableParallelThreads, bool isProcessWide)
         : JobProcessor(true),
         jobReady(true),
         wakeAllBackgroundThreads(false),
@@ -623,7 +700,7 @@ namespace JsUtil
         if (!threadService->HasCallback())
         {
             // We don't have a thread service, so create a dedicated thread to handle background jobs.
-            InitializeParallelThreadData(policyManager, disableParallelThreads);
+            InitializeParallelThreadData(policyManager, disableParallelThreads, isProcessWide);
         }
         else
         {
@@ -998,6 +1075,21 @@ namespace JsUtil
         return __super::RemoveJob(job);
     }
 
+    bool BackgroundJobProcessor::UpdateJobPriority(Job *const job, const uint priority)
+    {
+        // This function is called from inside the lock
+
+        Assert(job);
+        Assert(managers.Contains(job->Manager()));
+        Assert(!IsClosed());
+
+        if (IsBeingProcessed(job))
+        {
+            return false;
+        }
+        return __super::UpdateJobPriority(job, priority);
+    }
+
     bool BackgroundJobProcessor::Process(Job *const job, ParallelThreadData *threadData)
     {
         try
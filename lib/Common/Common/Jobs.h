@@ -44,6 +44,11 @@ namespace JsUtil
         // JobManager::JobProcessed(succeeded = false).
         const bool isCritical;
 
+        // Jobs with a higher priority are queued ahead of jobs with a lower priority. Jobs of the same priority are queued in
+        // FIFO order, or in LIFO order if they were prioritized when added. All jobs have priority 0 unless their manager says
+        // otherwise, in which case the queue is a plain FIFO/LIFO queue.
+        uint priority;
+
     private:
         Job(const bool isCritical = false);
     public:
@@ -65,6 +70,10 @@ namespace JsUtil
     public:
         JobManager *Manager() const;
         bool IsCritical() const;
+        uint Priority() const;
+
+        // Must not be called while the job is queued; use JobProcessor::UpdateJobPriority instead
+        void SetPriority(const uint priority);
     };
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -99,6 +108,10 @@ namespace JsUtil
         JobProcessor *Processor() const;
 
     protected:
+        // Number of this manager's jobs that were added to the job processor and are not yet processed. Must be called from
+        // inside the lock.
+        unsigned int NumJobsAddedToProcessor() const;
+
         // Called by the job processor (outside the lock) to process a job. A job manager may choose to return false to indicate
         // a failure. Throwing OutOfMemoryException or OperationAbortedException also indicate a processing failure.
         // 'pageAllocator' will be null if the job is being processed in the foreground.
@@ -336,6 +349,10 @@ namespace JsUtil
         // Must be called from inside the lock
         virtual bool RemoveJob(Job *const job);
 
+        // Changes the priority of a queued job and moves it to its new place in the queue. Returns false if the job is already
+        // being processed. Must be called from inside the lock.
+        virtual bool UpdateJobPriority(Job *const job, const uint priority);
+
         template<class TJobManager, class TJobHolder>
         void AddJobAndProcessProactively(TJobManager *const jobManager, const TJobHolder holder);
 
@@ -354,6 +371,7 @@ namespace JsUtil
         virtual void DissociatePageAllocator(PageAllocator* const pageAllocator) = 0;
 
     protected:
+        void LinkJob(Job *const job, const bool prioritize);
         void JobProcessed(JobManager *const manager, Job *const job, const bool succeeded);
         void LastJobProcessed(JobManager *const manager);
 
@@ -471,7 +489,8 @@ namespace JsUtil
 #endif
 
     public:
-        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads);
+        // A process-wide job processor is shared by all thread contexts, see ThreadBoundThreadContextManager::GetSharedJobProcessor
+        BackgroundJobProcessor(AllocationPolicyManager* policyManager, ThreadService *threadService, bool disableParallelThreads, bool isProcessWide = false);
         ~BackgroundJobProcessor();
 
 #if PDATA_ENABLED && defined(_WIN32)
@@ -491,8 +510,8 @@ namespace JsUtil
         Job* GetCurrentJobOfManager(JobManager *const manager);
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
 
-        void InitializeThreadCount();
-        void InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads);
+        void InitializeThreadCount(bool isProcessWide);
+        void InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads, bool isProcessWide);
         void InitializeParallelThreadDataForThreadServiceCallBack(AllocationPolicyManager* policyManager);
 
 #if PDATA_ENABLED && defined(_WIN32)
@@ -509,6 +528,7 @@ namespace JsUtil
 
         virtual void AddJob(Job *const job, const bool prioritize = false) override;
         virtual bool RemoveJob(Job *const job) override;
+        virtual bool UpdateJobPriority(Job *const job, const uint priority) override;
 
         template<class TJobManager, class TJobHolder>
         void AddJobAndProcessProactively(TJobManager *const jobManager, const TJobHolder holder);
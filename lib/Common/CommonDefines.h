@@ -106,6 +106,13 @@
 // ByteCode
 #define VARIABLE_INT_ENCODING 1                     // Byte code serialization variable size int field encoding
 #define BYTECODE_BRANCH_ISLAND                      // Byte code short branch and branch island
+// Interpreter handlers dispatch the next opcode through a computed goto table (build.sh --threaded-interpreter)
+#if !defined(__clang__) && !defined(__GNUC__)
+#undef ENABLE_THREADED_INTERPRETER
+#define ENABLE_THREADED_INTERPRETER 0               // Needs the labels as values extension
+#elif !defined(ENABLE_THREADED_INTERPRETER)
+#define ENABLE_THREADED_INTERPRETER 0
+#endif
 #if defined(_WIN32) || defined(HAS_REAL_ICU)
 #define ENABLE_UNICODE_API 1                        // Enable use of Unicode-related APIs
 #endif
@@ -172,27 +179,40 @@
 
 #ifndef ENABLE_VALGRIND
 #define ENABLE_CONCURRENT_GC 1
-#ifdef _WIN32
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 1 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
 #else
-#define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 0 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
-#endif
-#else
 #define ENABLE_CONCURRENT_GC 0
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 0 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
 #endif
 
 #ifdef _WIN32
 #define SYSINFO_IMAGE_BASE_AVAILABLE 1
-#define SUPPORT_WIN32_SLIST 1
 #ifndef CHAKRACORE_LITE
 #define ENABLE_JS_ETW                               // ETW support
 #endif
 #else
 #define SYSINFO_IMAGE_BASE_AVAILABLE 0
-#define SUPPORT_WIN32_SLIST 0
 #endif
 
+// Interlocked SList API; CommonPal.h provides a lock based version outside of Windows
+#define SUPPORT_WIN32_SLIST 1
+
+#if !defined(_WIN32) && defined(TARGET_64)
+#define ENABLE_SEGMENT_PLACEMENT_HINTS 1            // Huge page and NUMA placement of page allocator segments through the PAL
+#else
+#define ENABLE_SEGMENT_PLACEMENT_HINTS 0
+#endif
+
+// Huge page segments grow every PageSegment to 2MB, so they are opt in (build.sh --huge-page-segments)
+#if !ENABLE_SEGMENT_PLACEMENT_HINTS
+#undef ENABLE_HUGE_PAGE_SEGMENTS
+#define ENABLE_HUGE_PAGE_SEGMENTS 0
+#elif !defined(ENABLE_HUGE_PAGE_SEGMENTS)
+#define ENABLE_HUGE_PAGE_SEGMENTS 0
+#endif
+
+#define ENABLE_SHARED_PAGE_POOL 1                   // Process-wide pool of committed page segments shared between page allocators
+
 #ifdef CHAKRACORE_LITE
 #define USE_VPM_TABLE 0
 #else
@@ -277,10 +297,8 @@
 #endif
 #endif
 
-// Only enable background parser in debug build.
-#ifdef DBG
+// Parallel parsing is still opt-in, through -on:ParallelParse or -ParallelParseThreshold
 #define ENABLE_BACKGROUND_PARSING 1
-#endif
 
 #if ENABLE_DEBUG_CONFIG_OPTIONS
 #define ALLOW_JIT_REPRO
@@ -288,13 +306,18 @@
 
 #endif
 
+#if ENABLE_PROFILE_INFO
+#define ENABLE_PERSISTENT_PROFILE_CACHE 1           // File based startup profile cache, keyed by source hash
+#endif
+
 #if ENABLE_NATIVE_CODEGEN
 #ifdef _WIN32
 #define ENABLE_OOP_NATIVE_CODEGEN 1     // Out of process JIT
 #endif
 
 // ToDo (SaAgarwa): Disable VirtualTypedArray on ARM64 till we make sure it works correctly
-#if defined(_WIN32) && defined(TARGET_64) && !defined(_M_ARM64)
+// xplat: out of bounds accesses are recovered from the PAL's SIGSEGV handler, which macOS doesn't use (mach exceptions)
+#if defined(TARGET_64) && !defined(_M_ARM64) && (defined(_WIN32) || defined(__linux__))
 #define ENABLE_FAST_ARRAYBUFFER 1
 #endif
 #endif
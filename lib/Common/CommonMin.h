@@ -65,5 +65,6 @@ using namespace Memory;
 #include "Memory/VirtualAllocWrapper.h"
 #include "Memory/MemoryTracking.h"
 #include "Memory/AllocationPolicyManager.h"
+#include "Memory/SharedPagePool.h"
 #include "Memory/PageAllocator.h"
 #include "Memory/ArenaAllocator.h"
@@ -358,7 +358,7 @@ typedef struct _SINGLE_LIST_ENTRY SLIST_ENTRY, *PSLIST_ENTRY;
 
 #endif // defined(TARGET_64)
 
-#if defined(_AMD64_)
+#if defined(_AMD64_) || defined(_ARM64_)
 
 typedef union DECLSPEC_ALIGN(16) _SLIST_HEADER {
   struct {  // original struct
@@ -397,9 +397,162 @@ typedef union _SLIST_HEADER {
 
 #endif
 
-PALIMPORT VOID PALAPI InitializeSListHead(IN OUT PSLIST_HEADER ListHead);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY  ListEntry);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead);
+//
+// There is no kernel support for interlocked singly linked lists outside of Windows. The
+// SList functions below serialize on a spin lock kept in header bits that the Windows layout
+// reserves, so SLIST_HEADER keeps its size and alignment. A lock is used instead of a
+// compare-exchange loop because callers free entries as soon as they are popped, and a
+// lock-free pop would have to read the Next field of an entry another thread may have freed.
+//
+
+#if defined(_AMD64_) || defined(_ARM64_)
+
+#define PAL_SLIST_LOCK_BIT 0x1ull // Reserved bits; entries are 16 byte aligned
+
+inline ULONGLONG volatile * PAL_SListLockWord(PSLIST_HEADER ListHead)
+{
+    return &ListHead->DUMMYSTRUCTNAME.Region;
+}
+
+inline PSLIST_ENTRY PAL_SListFirst(PSLIST_HEADER ListHead)
+{
+    return (PSLIST_ENTRY)(ListHead->DUMMYSTRUCTNAME.Region & ~0xFull);
+}
+
+inline void PAL_SListSetFirst(PSLIST_HEADER ListHead, PSLIST_ENTRY ListEntry)
+{
+    // Only called with the lock held, so keep the lock bit set
+    ListHead->DUMMYSTRUCTNAME.Region = (ULONGLONG)ListEntry | PAL_SLIST_LOCK_BIT;
+}
+
+inline USHORT PAL_SListDepth(PSLIST_HEADER ListHead)
+{
+    return (USHORT)ListHead->HeaderX64.Depth;
+}
+
+inline void PAL_SListSetDepth(PSLIST_HEADER ListHead, USHORT Depth)
+{
+    ListHead->HeaderX64.Depth = Depth;
+}
+
+#else
+
+#define PAL_SLIST_LOCK_BIT 0x8000000000000000ull // CpuId/Reserved word
+
+inline ULONGLONG volatile * PAL_SListLockWord(PSLIST_HEADER ListHead)
+{
+    return &ListHead->Alignment;
+}
+
+inline PSLIST_ENTRY PAL_SListFirst(PSLIST_HEADER ListHead)
+{
+    return ListHead->DUMMYSTRUCTNAME.Next.Next;
+}
+
+inline void PAL_SListSetFirst(PSLIST_HEADER ListHead, PSLIST_ENTRY ListEntry)
+{
+    ListHead->DUMMYSTRUCTNAME.Next.Next = ListEntry;
+}
+
+inline USHORT PAL_SListDepth(PSLIST_HEADER ListHead)
+{
+    return ListHead->DUMMYSTRUCTNAME.Depth;
+}
+
+inline void PAL_SListSetDepth(PSLIST_HEADER ListHead, USHORT Depth)
+{
+    ListHead->DUMMYSTRUCTNAME.Depth = Depth;
+}
+
+#endif
+
+inline void PAL_SListAcquire(PSLIST_HEADER ListHead)
+{
+    ULONGLONG volatile * lockWord = PAL_SListLockWord(ListHead);
+    while ((*lockWord & PAL_SLIST_LOCK_BIT) != 0
+        || (__sync_fetch_and_or(lockWord, PAL_SLIST_LOCK_BIT) & PAL_SLIST_LOCK_BIT) != 0)
+    {
+        YieldProcessor();
+    }
+}
+
+inline void PAL_SListRelease(PSLIST_HEADER ListHead)
+{
+    __sync_fetch_and_and(PAL_SListLockWord(ListHead), ~PAL_SLIST_LOCK_BIT);
+}
+
+inline VOID InitializeSListHead(IN OUT PSLIST_HEADER ListHead)
+{
+    memset(ListHead, 0, sizeof(SLIST_HEADER));
+}
+
+inline PSLIST_ENTRY InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY ListEntry)
+{
+    PAL_SListAcquire(ListHead);
+    PSLIST_ENTRY first = PAL_SListFirst(ListHead);
+    ListEntry->Next = first;
+    PAL_SListSetFirst(ListHead, ListEntry);
+    PAL_SListSetDepth(ListHead, (USHORT)(PAL_SListDepth(ListHead) + 1));
+    PAL_SListRelease(ListHead);
+    return first;
+}
+
+inline PSLIST_ENTRY InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead)
+{
+    PAL_SListAcquire(ListHead);
+    PSLIST_ENTRY first = PAL_SListFirst(ListHead);
+    if (first != nullptr)
+    {
+        PAL_SListSetFirst(ListHead, first->Next);
+        PAL_SListSetDepth(ListHead, (USHORT)(PAL_SListDepth(ListHead) - 1));
+    }
+    PAL_SListRelease(ListHead);
+    return first;
+}
+
+inline PSLIST_ENTRY InterlockedFlushSList(IN OUT PSLIST_HEADER ListHead)
+{
+    PAL_SListAcquire(ListHead);
+    PSLIST_ENTRY first = PAL_SListFirst(ListHead);
+    PAL_SListSetFirst(ListHead, nullptr);
+    PAL_SListSetDepth(ListHead, 0);
+    PAL_SListRelease(ListHead);
+    return first;
+}
+
+inline USHORT QueryDepthSList(IN PSLIST_HEADER ListHead)
+{
+    // Like the Windows version this is only a snapshot and does not take the lock
+    return PAL_SListDepth(ListHead);
+}
+
+#if defined(TARGET_64)
+#define MEMORY_ALLOCATION_ALIGNMENT 16
+#else
+#define MEMORY_ALLOCATION_ALIGNMENT 8
+#endif
+
+inline void * _aligned_malloc(size_t size, size_t alignment)
+{
+    // Keep the pointer malloc returned right below the aligned block so _aligned_free can find it
+    void * block = malloc(size + alignment - 1 + sizeof(void *));
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    UINT_PTR aligned = ((UINT_PTR)block + sizeof(void *) + alignment - 1) & ~(UINT_PTR)(alignment - 1);
+    ((void **)aligned)[-1] = block;
+    return (void *)aligned;
+}
+
+inline void _aligned_free(void * memblock)
+{
+    if (memblock != nullptr)
+    {
+        free(((void **)memblock)[-1]);
+    }
+}
 
 
 template <class T>
@@ -327,6 +327,7 @@ PHASE(All)
 #endif
         PHASE(JITLoopBody)
         PHASE(JITLoopBodyInTryCatch)
+        PHASE(JITLoopBodyAfterFullJit)
         PHASE(ReJIT)
         PHASE(ExecutionMode)
         PHASE(SimpleJitDynamicProfile)
@@ -403,6 +404,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_WasmMaxTableSize     (10000000)
 #define DEFAULT_CONFIG_WasmSimd             (false)
 #define DEFAULT_CONFIG_WasmSignExtends      (false)
+#define DEFAULT_CONFIG_WasmBulkMemory       (false)
+#define DEFAULT_CONFIG_WasmValidateUpfront  (false)
 #define DEFAULT_CONFIG_BgJitDelayFgBuffer   (0)
 #define DEFAULT_CONFIG_BgJitPendingFuncCap  (31)
 #define DEFAULT_CONFIG_CurrentSourceInfo    (true)
@@ -482,6 +485,9 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_MaxJitThreadCount        (2)
 #define DEFAULT_CONFIG_ForceMaxJitThreadCount   (false)
+#define DEFAULT_CONFIG_SharedJitThreadPool      (false)
+#define DEFAULT_CONFIG_SharedJitThreadCount     (0)
+#define DEFAULT_CONFIG_JitPriorityScheduling    (false)
 
 #define DEFAULT_CONFIG_MitigateSpectre (true)
 
@@ -525,6 +531,7 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_DeferParseThreshold             (4 * 1024) // Unit is number of characters
 #define DEFAULT_CONFIG_ProfileBasedDeferParseThreshold (100)      // Unit is number of characters
+#define DEFAULT_CONFIG_ParallelParseThreshold          (0)        // Unit is number of characters; 0 disables
 
 #define DEFAULT_CONFIG_ProfileBasedSpeculativeJit (true)
 #define DEFAULT_CONFIG_WininetProfileCache        (true)
@@ -655,6 +662,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_MinProfileIterations (16)
 #define DEFAULT_CONFIG_MinProfileIterations_OldSimpleJit (25)
 #define DEFAULT_CONFIG_MinSimpleJitIterations (16)
+#define DEFAULT_CONFIG_BaselineJitMaxByteCodeCount (0)   // 0 disables
 #define DEFAULT_CONFIG_NewSimpleJit (false)
 
 #define DEFAULT_CONFIG_MaxLinearIntCaseCount     (3)       // Maximum number of cases (in switch statement) for which instructions can be generated linearly.
@@ -897,6 +905,8 @@ FLAGNR(Boolean, WasmFold              , "Enable i32/i64 const folding", DEFAULT_
 FLAGNR(Boolean, WasmIgnoreResponse    , "Ignore the type of the Response object", DEFAULT_CONFIG_WasmIgnoreResponse)
 FLAGNR(Number,  WasmMaxTableSize      , "Maximum size allowed to the WebAssembly.Table", DEFAULT_CONFIG_WasmMaxTableSize)
 FLAGNR(Boolean, WasmSignExtends       , "Use new WebAssembly sign extension operators", DEFAULT_CONFIG_WasmSignExtends)
+FLAGNR(Boolean, WasmBulkMemory        , "Use new WebAssembly bulk memory operators", DEFAULT_CONFIG_WasmBulkMemory)
+FLAGNR(Boolean, WasmValidateUpfront   , "Validate deferred WebAssembly function bodies when the module is compiled, on the background job threads when available", DEFAULT_CONFIG_WasmValidateUpfront)
 #ifdef ENABLE_WASM_SIMD
 FLAGNR(Boolean, WasmSimd              , "Enable SIMD in WebAssembly", DEFAULT_CONFIG_WasmSimd)
 #endif
@@ -927,6 +937,7 @@ FLAGNR(Boolean, CreateFunctionProxy   , "Create function proxies instead of full
 FLAGNR(Boolean, HybridFgJit           , "When background JIT is enabled, enable jitting in the foreground based on heuristics. This flag is only effective when OptimizeForManyInstances is disabled (UI threads).", DEFAULT_CONFIG_HybridFgJit)
 FLAGNR(Number,  HybridFgJitBgQueueLengthThreshold, "The background job queue length must exceed this threshold to consider jitting in the foreground", DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold)
 FLAGNR(Boolean, BytecodeHist          , "Provide a histogram of the bytecodes run by the script. (NoNative required).", false)
+FLAGNR(Boolean, BytecodePairHist      , "Provide a histogram of the adjacent bytecode pairs run by the script, e.g. to pick interpreter superinstructions. (NoNative required).", false)
 FLAGNR(Boolean, CurrentSourceInfo     , "Enable IASD get current script source info", DEFAULT_CONFIG_CurrentSourceInfo)
 FLAGNR(Boolean, CFGLog                , "Log CFG checks", false)
 FLAGNR(Boolean, CheckAlignment        , "Insert checks in the native code to verify 8-byte alignment of stack", false)
@@ -984,6 +995,10 @@ FLAGNRA(String, DynamicProfileInput   , Dpi, "Read only file containing dynamic
 #ifdef EDIT_AND_CONTINUE
 FLAGNR(Boolean, EditTest              , "Enable edit and continue test tools", false)
 #endif
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+FLAGR (String,  PersistentProfileCacheDir, "Directory in which startup profiles are persisted across runs, keyed by source hash", nullptr)
+FLAGNR(Boolean, ForceCorruptPersistentProfileCache, "Corrupt the persistent profile files as they are written, to test that they are rejected when loaded", false)
+#endif
 FLAGNR(Boolean, WininetProfileCache, "Use the WININET cache to save the profile information", DEFAULT_CONFIG_WininetProfileCache)
 FLAGNR(Boolean, NoDynamicProfileInMemoryCache, "Enable in-memory cache for dynamic sources", false)
 FLAGNR(Boolean, ProfileBasedSpeculativeJit, "Enable dynamic profile based speculative JIT", DEFAULT_CONFIG_ProfileBasedSpeculativeJit)
@@ -1227,6 +1242,9 @@ FLAGNR(Number,  LoopBodySizeThresholdToDisableOpts, "Minimum bytecode size of a
 
 FLAGNR(Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
 FLAGNR(Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
+FLAGR (Boolean, SharedJitThreadPool   , "Use one process-wide pool of background jit threads for all runtimes", DEFAULT_CONFIG_SharedJitThreadPool)
+FLAGR (Number,  SharedJitThreadCount  , "Number of threads in the shared background jit thread pool (0 = based on processor count)", DEFAULT_CONFIG_SharedJitThreadCount)
+FLAGR (Boolean, JitPriorityScheduling , "Order the background jit queue by how hot each function or loop body is, with fairness between script contexts", DEFAULT_CONFIG_JitPriorityScheduling)
 
 FLAGR(Boolean, MitigateSpectre, "Use mitigations for Spectre", DEFAULT_CONFIG_MitigateSpectre)
 
@@ -1261,6 +1279,7 @@ FLAGR (Number,  ProfilingInterpreter0Limit, "Limit after which to transition to
 FLAGR (Number,  AutoProfilingInterpreter1Limit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_AutoProfilingInterpreter1Limit)
 FLAGR (Number,  SimpleJitLimit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_SimpleJitLimit)
 FLAGR (Number,  ProfilingInterpreter1Limit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_ProfilingInterpreter1Limit)
+FLAGR (Number,  BaselineJitMaxByteCodeCount, "Functions without loops and with at most this many byte codes go from the auto-profiling interpreter straight to simple JIT, ahead of queued full JIT work (0 = never)", DEFAULT_CONFIG_BaselineJitMaxByteCodeCount)
 
 FLAGNRA(String, ExecutionModeLimits,        Eml,  "Execution mode limits in th form: AutoProfilingInterpreter0.ProfilingInterpreter0.AutoProfilingInterpreter1.SimpleJit.ProfilingInterpreter1 - Example: -ExecutionModeLimits:12.4.0.132.12", _u(""))
 FLAGRA(Boolean, EnforceExecutionModeLimits, Eeml, "Enforces the execution mode limits such that they are never exceeded.", false)
@@ -1517,6 +1536,14 @@ FLAGNR(NumberSet, BailoutTraceFilter, "Filter the bailout trace messages to spec
 FLAGNR(NumberSet, RejitTraceFilter, "Filter the rejit trace messages to specific bailout kinds.", )
 
 // recycler heuristic flags
+FLAGR (Number,  RecyclerNurserySize, "Size in KB of new allocations that triggers a partial (nursery) collect while in partial collect mode (0 = adaptive)", 0)
+FLAGR (Number,  RecyclerMaxPartialCollectCount, "Maximum number of partial collects between full collects (0 = no limit)", 0)
+FLAGR (Number,  ParallelParseThreshold, "Minimum size, in characters, of a script whose function bodies are parsed in parallel on the background job threads (0 = never)", DEFAULT_CONFIG_ParallelParseThreshold)
+FLAGR (Number,  ParallelMarkThreadCount, "Number of threads to use for parallel mark, including the main thread (0 = based on processor count, at most 4)", 0)
+FLAGR (Boolean, HugePageSegments, "Reserve recycler and JIT data page segments as 2MB aligned transparent huge pages (Linux 64-bit builds with --huge-page-segments only)", false)
+FLAGR (Boolean, NumaLocalSegments, "Prefer the NUMA node of the reserving thread for page allocator segments (Linux 64-bit only)", false)
+FLAGR (Number,  SharedPagePoolMaxPageCount, "Maximum number of committed pages that runtimes in the process can hand to each other instead of releasing them (0 = disabled)", 0)
+FLAGR (Number,  SharedPagePoolQuota, "Maximum number of pages a runtime may take from the shared page pool beyond what it gave back (0 = no limit)", 0)
 FLAGNR(Number,  MaxBackgroundFinishMarkCount, "Maximum number of background finish mark", 1)
 FLAGNR(Number,  BackgroundFinishMarkWaitTime, "Millisecond to wait for background finish mark", 15)
 FLAGNR(Number,  MinBackgroundRepeatMarkRescanBytes, "Minimum number of bytes rescan to trigger background finish mark",  -1)
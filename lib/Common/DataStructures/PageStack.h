@@ -15,6 +15,33 @@ class PageStack
     static const size_t EntriesPerChunk = (AutoSystemInfo::PageSize - sizeof(Chunk)) / sizeof(T);
 
 public:
+    // Work pool shared by the stacks taking part in a parallel operation (e.g. parallel mark).
+    // A stack that runs dry waits here for work; a stack that still holds more than two chunks
+    // hands one of its full chunks over whenever somebody is waiting.
+    class StealPool
+    {
+    public:
+        StealPool();
+        ~StealPool();
+
+        void Reset();
+        void Join();
+        bool HasWaiters() const { return waiterCount != 0; }
+
+    private:
+        friend class PageStack<T>;
+
+        void Donate(Chunk * chunk);
+        Chunk * TryTake();
+        Chunk * Wait();
+
+        CriticalSection cs;
+        Chunk * volatile donatedChunks;
+        volatile LONG participantCount;
+        volatile LONG idleCount;
+        volatile LONG waiterCount;
+    };
+
     PageStack(PagePool * pagePool);
     ~PageStack();
 
@@ -26,6 +53,9 @@ class PageStack
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    void SetStealPool(StealPool * stealPool) { this->stealPool = stealPool; }
+    bool Steal();
+
     void Abort();
     void Release();
 
@@ -49,6 +79,7 @@ class PageStack
 private:
     Chunk * CreateChunk();
     void FreeChunk(Chunk * chunk);
+    void DonateChunk();
 
 private:
     T * nextEntry;
@@ -56,6 +87,7 @@ class PageStack
     T * chunkEnd;
     Chunk * currentChunk;
     PagePool * pagePool;
+    StealPool * stealPool;
     bool usesReservedPages;
 
 #if DBG
@@ -91,6 +123,11 @@ bool PageStack<T>::Pop(T * item)
         chunkStart = currentChunk->entries;
         chunkEnd = &currentChunk->entries[EntriesPerChunk];
         nextEntry = chunkEnd;
+
+        if (stealPool != nullptr && stealPool->HasWaiters())
+        {
+            DonateChunk();
+        }
     }
 
     Assert(nextEntry > chunkStart && nextEntry <= chunkEnd);
@@ -127,6 +164,11 @@ bool PageStack<T>::Push(T item)
         chunkStart = currentChunk->entries;
         chunkEnd = &currentChunk->entries[EntriesPerChunk];
         nextEntry = chunkStart;
+
+        if (stealPool != nullptr && stealPool->HasWaiters())
+        {
+            DonateChunk();
+        }
     }
 
     Assert(nextEntry >= chunkStart && nextEntry < chunkEnd);
@@ -146,6 +188,7 @@ bool PageStack<T>::Push(T item)
 template <typename T>
 PageStack<T>::PageStack(PagePool * pagePool) :
     pagePool(pagePool),
+    stealPool(nullptr),
     currentChunk(nullptr),
     nextEntry(nullptr),
     chunkStart(nullptr),
@@ -356,6 +399,179 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+void PageStack<T>::DonateChunk()
+{
+    // Called by the owning thread on a chunk boundary when another stack is waiting for work.
+    // Every chunk below the current one is full. Keep the current chunk and the one below it
+    // so we don't immediately run dry ourselves, and give away the next one.
+    Assert(stealPool != nullptr);
+
+    Chunk * keptChunk = currentChunk->nextChunk;
+    if (keptChunk == nullptr)
+    {
+        return;
+    }
+
+    Chunk * donatedChunk = keptChunk->nextChunk;
+    if (donatedChunk == nullptr || donatedChunk->IsReserved())
+    {
+        // Reserved pages have to go back to the pool that owns them, so they never change hands.
+        return;
+    }
+
+    keptChunk->nextChunk = donatedChunk->nextChunk;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount--;
+#endif
+#if DBG
+    this->count -= EntriesPerChunk;
+#endif
+
+    stealPool->Donate(donatedChunk);
+}
+
+
+template <typename T>
+bool PageStack<T>::Steal()
+{
+    // Wait for a chunk donated by another stack.
+    // Returns false once every participant is out of work, which means the parallel operation is done.
+    Assert(IsEmpty());
+
+    if (stealPool == nullptr)
+    {
+        return false;
+    }
+
+    Chunk * chunk = stealPool->Wait();
+    if (chunk == nullptr)
+    {
+        return false;
+    }
+
+    // Drop our (empty) preallocated chunk and make the stolen one our only chunk,
+    // the same way Split hands chunks to its target stacks.
+    Release();
+
+    chunk->nextChunk = nullptr;
+    currentChunk = chunk;
+    chunkStart = chunk->entries;
+    chunkEnd = &chunk->entries[EntriesPerChunk];
+    nextEntry = chunkEnd;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    this->pageCount = 1;
+#endif
+#if DBG
+    this->count = EntriesPerChunk;
+#endif
+
+    return true;
+}
+
+
+template <typename T>
+PageStack<T>::StealPool::StealPool() :
+    donatedChunks(nullptr),
+    participantCount(0),
+    idleCount(0),
+    waiterCount(0)
+{
+}
+
+
+template <typename T>
+PageStack<T>::StealPool::~StealPool()
+{
+    Assert(donatedChunks == nullptr);
+}
+
+
+template <typename T>
+void PageStack<T>::StealPool::Reset()
+{
+    // Only called between parallel operations, when all participants have stopped.
+    Assert(donatedChunks == nullptr);
+    Assert(waiterCount == 0);
+    Assert(idleCount == participantCount);
+
+    this->participantCount = 0;
+    this->idleCount = 0;
+}
+
+
+template <typename T>
+void PageStack<T>::StealPool::Join()
+{
+    // A participant that joins after everyone else has already finished simply drains its own stack;
+    // it will find the pool empty and all other participants idle when it runs out of work.
+    InterlockedIncrement(&this->participantCount);
+}
+
+
+template <typename T>
+void PageStack<T>::StealPool::Donate(Chunk * chunk)
+{
+    AutoCriticalSection autocs(&this->cs);
+    chunk->nextChunk = this->donatedChunks;
+    this->donatedChunks = chunk;
+}
+
+
+template <typename T>
+typename PageStack<T>::Chunk * PageStack<T>::StealPool::TryTake()
+{
+    if (this->donatedChunks == nullptr)
+    {
+        return nullptr;
+    }
+
+    AutoCriticalSection autocs(&this->cs);
+    Chunk * chunk = this->donatedChunks;
+    if (chunk != nullptr)
+    {
+        this->donatedChunks = chunk->nextChunk;
+    }
+    return chunk;
+}
+
+
+template <typename T>
+typename PageStack<T>::Chunk * PageStack<T>::StealPool::Wait()
+{
+    InterlockedIncrement(&this->waiterCount);
+    InterlockedIncrement(&this->idleCount);
+
+    Chunk * chunk;
+    while (true)
+    {
+        // Sample the idle count before looking for work. Only busy participants donate,
+        // so if everybody was idle and the pool is still empty afterwards, there is no work left.
+        bool allIdle = (this->idleCount == this->participantCount);
+
+        chunk = TryTake();
+        if (chunk != nullptr)
+        {
+            InterlockedDecrement(&this->idleCount);
+            break;
+        }
+
+        if (allIdle)
+        {
+            // Leave idleCount incremented: a finished participant stays idle for the rest of the operation.
+            break;
+        }
+
+        YieldProcessor();
+    }
+
+    InterlockedDecrement(&this->waiterCount);
+    return chunk;
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
@@ -29,6 +29,10 @@ typedef bool (__stdcall * PageAllocatorMemoryAllocationCallback)(__in LPVOID con
     size_t memoryLimit;
     size_t currentMemory;
     bool supportConcurrency;
+#if ENABLE_SHARED_PAGE_POOL
+    // Pages taken from the SharedPagePool minus pages handed to it
+    ptrdiff_t sharedPagePoolBalance;
+#endif
     CriticalSection cs;
     void * context;
     PageAllocatorMemoryAllocationCallback memoryAllocationCallback;
@@ -38,6 +42,9 @@ typedef bool (__stdcall * PageAllocatorMemoryAllocationCallback)(__in LPVOID con
         memoryLimit((size_t)-1),
         currentMemory(0),
         supportConcurrency(needConcurrencySupport),
+#if ENABLE_SHARED_PAGE_POOL
+        sharedPagePoolBalance(0),
+#endif
         context(NULL),
         memoryAllocationCallback(NULL)
     {
@@ -104,6 +111,36 @@ typedef bool (__stdcall * PageAllocatorMemoryAllocationCallback)(__in LPVOID con
         }
     }
 
+#if ENABLE_SHARED_PAGE_POOL
+    // Enforce the per-runtime quota on pages taken from the process-wide SharedPagePool.
+    // A quota of 0 means no limit.
+    bool RequestSharedPagePoolPages(size_t pageCount, size_t quota)
+    {
+        if (supportConcurrency)
+        {
+            AutoCriticalSection auto_cs(&cs);
+            return RequestSharedPagePoolPagesImpl(pageCount, quota);
+        }
+        else
+        {
+            return RequestSharedPagePoolPagesImpl(pageCount, quota);
+        }
+    }
+
+    void ReportSharedPagePoolPagesReturned(size_t pageCount)
+    {
+        if (supportConcurrency)
+        {
+            AutoCriticalSection auto_cs(&cs);
+            sharedPagePoolBalance -= (ptrdiff_t)pageCount;
+        }
+        else
+        {
+            sharedPagePoolBalance -= (ptrdiff_t)pageCount;
+        }
+    }
+#endif
+
     void SetMemoryAllocationCallback(LPVOID newContext, PageAllocatorMemoryAllocationCallback callback)
     {
         this->memoryAllocationCallback = callback;
@@ -148,6 +185,20 @@ typedef bool (__stdcall * PageAllocatorMemoryAllocationCallback)(__in LPVOID con
         }
     }
 
+#if ENABLE_SHARED_PAGE_POOL
+    inline bool RequestSharedPagePoolPagesImpl(size_t pageCount, size_t quota)
+    {
+        ptrdiff_t newBalance = sharedPagePoolBalance + (ptrdiff_t)pageCount;
+        if (quota != 0 && newBalance > (ptrdiff_t)quota)
+        {
+            return false;
+        }
+
+        sharedPagePoolBalance = newBalance;
+        return true;
+    }
+#endif
+
     inline void ReportFreeImpl(MemoryAllocateEvent allocationEvent, size_t byteCount)
     {
         Assert(currentMemory >= byteCount);
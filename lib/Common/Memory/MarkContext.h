@@ -26,6 +26,8 @@ class MarkContext
 public:
     static const int MarkCandidateSize = sizeof(MarkCandidate);
 
+    typedef PageStack<MarkCandidate>::StealPool MarkStealPool;
+
     MarkContext(Recycler * recycler, PagePool * pagePool);
     ~MarkContext();
 
@@ -61,6 +63,11 @@ class MarkContext
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
 
+    // Work stealing between the contexts of a parallel mark. Only the mark stack takes part;
+    // precisely traced and tracked objects stay with the context that found them.
+    void SetStealPool(MarkStealPool * stealPool) { markStack.SetStealPool(stealPool); }
+    bool StealMarkWork() { return markStack.Steal(); }
+
     void Abort();
     void Release();
 
@@ -116,7 +116,18 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
         return false;
     }
 
-    this->address = (char *)GetAllocator()->GetVirtualAllocator()->AllocPages(NULL, totalPages, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+#if ENABLE_SHARED_PAGE_POOL
+    if (!addGuardPages && (allocFlags & MEM_COMMIT) != 0)
+    {
+        // Reuse a committed segment another page allocator in the process gave up
+        this->address = GetAllocator()->TryAllocFromSharedPagePool(totalPages);
+    }
+
+    if (this->address == nullptr)
+#endif
+    {
+        this->address = (char *)GetAllocator()->GetVirtualAllocator()->AllocPages(NULL, totalPages, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+    }
 
     if (this->address == nullptr)
     {
@@ -203,6 +214,57 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
     return true;
 }
 
+#if ENABLE_SHARED_PAGE_POOL
+template<typename T>
+bool
+SegmentBase<T>::ReleaseToSharedPagePool()
+{
+    Assert(this->address != nullptr);
+
+    PageAllocatorBase<T> * pageAllocator = GetAllocator();
+    if (!pageAllocator->CanUseSharedPagePool()
+        || this->leadingGuardPageCount != 0
+        || this->trailingGuardPageCount != 0
+        || !SharedPagePool::Instance.ReserveCapacity(this->segmentPageCount))
+    {
+        return false;
+    }
+    Assert(this->secondaryAllocator == nullptr);
+
+#if defined(TARGET_64) && defined(RECYCLER_WRITE_BARRIER_BYTE)
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (CONFIG_FLAG(StrictWriteBarrierCheck) && this->isWriteBarrierEnabled)
+    {
+        RecyclerWriteBarrierManager::ToggleBarrier(this->address, this->segmentPageCount * AutoSystemInfo::PageSize, false);
+    }
+#endif
+    RecyclerWriteBarrierManager::OnSegmentFree(this->address, this->segmentPageCount);
+#endif
+
+#ifdef PAGEALLOCATOR_PROTECT_FREEPAGE
+    // All the pages of an empty segment are protected as free pages. The pool keeps its entry in them and
+    // hands them out read-write, the same as newly committed memory.
+    DWORD oldProtect;
+    BOOL vpresult = VirtualProtect(this->address, this->segmentPageCount * AutoSystemInfo::PageSize, PAGE_READWRITE, &oldProtect);
+    Assert(vpresult != FALSE);
+    Assert(oldProtect == PAGE_NOACCESS);
+#endif
+
+    // The memory stays committed, but it no longer counts against this runtime
+    pageAllocator->ReportFree(this->segmentPageCount * AutoSystemInfo::PageSize);
+    if (pageAllocator->policyManager != nullptr)
+    {
+        pageAllocator->policyManager->ReportSharedPagePoolPagesReturned(this->segmentPageCount);
+    }
+
+    SharedPagePool::Instance.Add(this->address, this->segmentPageCount, pageAllocator->enableWriteBarrier);
+
+    // The destructor no longer owns the memory
+    this->address = nullptr;
+    return true;
+}
+#endif
+
 //=============================================================================================================
 // PageSegment
 //=============================================================================================================
@@ -697,6 +759,30 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
 
     this->maxAllocPageCount = maxAllocPageCount;
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (flagTable.HugePageSegments && (type == PageAllocatorType_Recycler || type == PageAllocatorType_BGJIT))
+    {
+        // Make each page segment exactly one aligned huge page. Guard pages would split the
+        // mapping and keep the kernel from backing it with a huge page, so leave them out.
+        this->allocFlags |= MEM_RESERVE_HUGEPAGES;
+        this->excludeGuardPages = true;
+        if (maxAllocPageCount + secondaryAllocPageCount < HugePageSegmentPageCount)
+        {
+            this->maxAllocPageCount = HugePageSegmentPageCount - secondaryAllocPageCount;
+        }
+    }
+#endif
+
+#if ENABLE_SEGMENT_PLACEMENT_HINTS
+
+    if (flagTable.NumaLocalSegments)
+    {
+        // Segments are normally reserved on the thread that owns the allocator, so this keeps
+        // a runtime's memory on the node its thread runs on.
+        this->allocFlags |= MEM_RESERVE_NUMA_LOCAL;
+    }
+#endif
+
 #if DBG
     // By default, a page allocator is not associated with any thread context
     // Any host which wishes to associate it with a thread context must do so explicitly
@@ -737,6 +823,10 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::~PageAllocatorBase()
     SubCommittedBytes(committedBytes);
     SubReservedBytes(reservedBytes);
 
+#if ENABLE_SHARED_PAGE_POOL
+    ReleaseEmptySegmentsToSharedPagePool();
+#endif
+
     ReleaseSegmentList(&segments);
     ReleaseSegmentList(&fullSegments);
     ReleaseSegmentList(&emptySegments);
@@ -843,6 +933,71 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::AllocPageSegment(
     return segment;
 }
 
+#if ENABLE_SHARED_PAGE_POOL
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+bool
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::CanUseSharedPagePool() const
+{
+    // Only zeroed, plain committed segments of this process can move between allocators
+    return SharedPagePool::IsEnabled()
+        && this->allocatorType == AllocatorType::VirtualAlloc
+        && this->type != PageAllocatorType::PageAllocatorType_CustomHeap
+        && this->processHandle == GetCurrentProcess()
+        && this->ZeroPages()
+        && this->secondaryAllocPageCount == 0
+        && this->allocFlags == 0
+#ifdef RECYCLER_MEMORY_VERIFY
+        && !this->verifyEnabled
+#endif
+#if defined(RECYCLER_NO_PAGE_REUSE) || defined(ARENA_MEMORY_VERIFY)
+        && !this->disablePageReuse
+#endif
+        ;
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+char *
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::TryAllocFromSharedPagePool(size_t pageCount)
+{
+    if (!CanUseSharedPagePool())
+    {
+        return nullptr;
+    }
+
+    size_t quota = (size_t)this->pageAllocatorFlagTable.SharedPagePoolQuota;
+    if (policyManager != nullptr && !policyManager->RequestSharedPagePoolPages(pageCount, quota))
+    {
+        return nullptr;
+    }
+
+    char * address = SharedPagePool::Instance.Take(pageCount, this->enableWriteBarrier);
+    if (address == nullptr && policyManager != nullptr)
+    {
+        policyManager->ReportSharedPagePoolPagesReturned(pageCount);
+    }
+    return address;
+}
+
+template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
+void
+PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::ReleaseEmptySegmentsToSharedPagePool()
+{
+    if (!CanUseSharedPagePool())
+    {
+        return;
+    }
+
+    FOREACH_DLISTBASE_ENTRY(TPageSegment, segment, &emptySegments)
+    {
+        if (!segment.ReleaseToSharedPagePool())
+        {
+            break;
+        }
+    }
+    NEXT_DLISTBASE_ENTRY
+}
+#endif
+
 template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
 TPageSegment *
 PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::AddPageSegment(DListBase<TPageSegment>& segmentList)
@@ -2072,6 +2227,10 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::DecommitNow(bool all)
         {
             Assert(emptySegments.Head().GetDecommitPageCount() == 0);
             LogFreeSegment(&emptySegments.Head());
+#if ENABLE_SHARED_PAGE_POOL
+            // Let another runtime in the process pick up the committed pages before they go back to the OS
+            emptySegments.Head().ReleaseToSharedPagePool();
+#endif
             emptySegments.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
 
             pageToDecommit -= maxAllocPageCount;
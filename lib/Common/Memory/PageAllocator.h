@@ -161,6 +161,9 @@ class SegmentBase: public SegmentBaseCommon
     }
 
     bool Initialize(DWORD allocFlags, bool excludeGuardPages);
+#if ENABLE_SHARED_PAGE_POOL
+    bool ReleaseToSharedPagePool();
+#endif
 
 #if DBG
     virtual bool IsPageSegment() const
@@ -233,9 +236,13 @@ class PageSegmentBase : public SegmentBase<TVirtualAlloc>
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, bool committed, bool allocated, bool enableWriteBarrier);
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, void* address, uint pageCount, uint committedCount, bool enableWriteBarrier);
     // Maximum possible size of a PageSegment; may be smaller.
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    static const uint MaxDataPageCount = 512;     // 2 MB, the size of huge page segments
+#else
     static const uint MaxDataPageCount = 256;     // 1 MB
+#endif
     static const uint MaxGuardPageCount = 16;
-    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;  // 272 Pages
+    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;  // 528 Pages with huge page segments, otherwise 272
 
     typedef BVStatic<MaxPageCount> PageBitVector;
 
@@ -491,6 +498,9 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     static uint const MinPartialDecommitFreePageCount = 0x1000;  // 16 MB
 
     static uint const DefaultMaxAllocPageCount = 32;        // 128K
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    static uint const HugePageSegmentPageCount = 512;       // 2M
+#endif
     static uint const DefaultSecondaryAllocPageCount = 0;
 
     static size_t GetProcessUsedBytes();
@@ -792,6 +802,13 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     bool QueueZeroPages() const { return queueZeroPages; }
 #endif
 
+    // Process-wide sharing of empty segments between page allocators
+#if ENABLE_SHARED_PAGE_POOL
+    bool CanUseSharedPagePool() const;
+    char * TryAllocFromSharedPagePool(size_t pageCount);
+    void ReleaseEmptySegmentsToSharedPagePool();
+#endif
+
 #if ENABLE_BACKGROUND_PAGE_FREEING
     FreePageEntry * PopPendingZeroPage();
 #endif
@@ -154,6 +154,9 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     concurrentWorkDoneEvent(NULL),
     parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
     parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
+    parallelMarkHelpers(nullptr),
+    parallelMarkHelperCount(0),
+    parallelMarkHelperIndex(0),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -176,6 +179,7 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     scanPinnedObjectMap(false),
     partialUncollectedAllocBytes(0),
     uncollectedNewPageCountPartialCollect((size_t)-1),
+    partialCollectCount(0),
 #if ENABLE_CONCURRENT_GC
     partialConcurrentNextCollection(false),
 #endif
@@ -256,6 +260,13 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     parallelMarkContext3.SetMarkMap(markMap);
 #endif
 
+#if ENABLE_CONCURRENT_GC
+    markContext.SetStealPool(&markStealPool);
+    parallelMarkContext1.SetStealPool(&markStealPool);
+    parallelMarkContext2.SetStealPool(&markStealPool);
+    parallelMarkContext3.SetStealPool(&markStealPool);
+#endif
+
 #ifdef RECYCLER_MEMORY_VERIFY
     verifyPad =  GetRecyclerFlagsTable().RecyclerVerifyPadSize;
     verifyEnabled =  GetRecyclerFlagsTable().IsEnabled(Js::RecyclerVerifyFlag);
@@ -535,6 +546,9 @@ Recycler::~Recycler()
     parallelMarkContext1.Release();
     parallelMarkContext2.Release();
     parallelMarkContext3.Release();
+#if ENABLE_CONCURRENT_GC
+    DeleteParallelMarkHelpers();
+#endif
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -857,6 +871,12 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
     this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    if (GetRecyclerFlagsTable().ParallelMarkThreadCount > 0)
+    {
+        // Explicit marker count. Markers beyond the four split contexts are helpers that steal their work.
+        uint parallelMarkThreadCount = (uint)GetRecyclerFlagsTable().ParallelMarkThreadCount;
+        this->maxParallelism = parallelMarkThreadCount < MaxParallelMarkThreadCount ? parallelMarkThreadCount : MaxParallelMarkThreadCount;
+    }
 
     if (forceInThread)
     {
@@ -880,6 +900,7 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
     else
     {
         this->disableConcurrent = false;
+        this->InitializeParallelMarkHelpers();
 
         if (deferThreadStartup || EnableConcurrent(threadService, false))
         {
@@ -978,6 +999,12 @@ Recycler::ClearNeedOOMRescan()
     parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
     parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
     parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+    }
+#endif
 }
 
 bool
@@ -2286,14 +2313,24 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+#if ENABLE_CONCURRENT_GC
+    // Once our own mark stack is drained, keep stealing from the other markers until all of them run out of work.
+    this->markStealPool.Join();
+    do
+#endif
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
     }
+#if ENABLE_CONCURRENT_GC
+    while (markContext->StealMarkWork());
+#endif
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
 
@@ -2391,6 +2428,12 @@ Recycler::ResetMarkCollectionState()
     // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
     parallelMarkContext2.Cleanup();
     parallelMarkContext3.Cleanup();
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->markContext.Cleanup();
+    }
+#endif
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2558,12 +2601,13 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= MaxParallelMarkThreadCount);
 
-    // Split the mark stack into [this->maxParallelism] equal pieces.
+    // Split the mark stack into [this->maxParallelism] equal pieces, up to 4 ways.
+    // Any markers beyond that are helpers, which get their share of the work by stealing.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
     MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
-    uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
+    uint actualSplitCount = markContext.Split(min(this->maxParallelism, 4u) - 1, splitContexts);
 
     Assert(actualSplitCount <= 3);
 
@@ -2583,6 +2627,8 @@ Recycler::DoParallelMark()
         StartQueueTrackedObject();
     }
 
+    this->markStealPool.Reset();
+
     // Kick off marking on the background thread
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
@@ -2590,12 +2636,17 @@ Recycler::DoParallelMark()
     // If the threads haven't been created yet, this will create them (or fail).
     bool parallelSuccess1 = false;
     bool parallelSuccess2 = false;
+    uint startedHelperCount = 0;
     if (concurrentSuccess && actualSplitCount >= 2)
     {
         parallelSuccess1 = parallelThread1.StartConcurrent();
         if (parallelSuccess1 && actualSplitCount == 3)
         {
             parallelSuccess2 = parallelThread2.StartConcurrent();
+            if (parallelSuccess2)
+            {
+                startedHelperCount = this->StartParallelMarkHelpers();
+            }
         }
     }
 
@@ -2637,6 +2688,8 @@ Recycler::DoParallelMark()
         }
     }
 
+    this->WaitForParallelMarkHelpers(startedHelperCount);
+
     this->collectionState = CollectionStateMark;
 
     // Process tracked objects, if any, then do one final mark phase in case they marked any new objects.
@@ -2667,10 +2720,10 @@ Recycler::DoBackgroundParallelMark()
     MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism <= MaxParallelMarkThreadCount);
         if (this->maxParallelism > 2)
         {
-            actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
+            actualSplitCount = markContext.Split(min(this->maxParallelism, 4u) - 2, splitContexts);
         }
     }
 
@@ -2691,15 +2744,21 @@ Recycler::DoBackgroundParallelMark()
 #endif
 
     this->collectionState = CollectionStateBackgroundParallelMark;
+    this->markStealPool.Reset();
 
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
     bool parallelSuccess1 = false;
     bool parallelSuccess2 = false;
+    uint startedHelperCount = 0;
     parallelSuccess1 = parallelThread1.StartConcurrent();
     if (parallelSuccess1 && actualSplitCount == 2)
     {
         parallelSuccess2 = parallelThread2.StartConcurrent();
+        if (parallelSuccess2)
+        {
+            startedHelperCount = this->StartParallelMarkHelpers();
+        }
     }
 
     // Process our portion of the split.
@@ -2728,6 +2787,8 @@ Recycler::DoBackgroundParallelMark()
         }
     }
 
+    this->WaitForParallelMarkHelpers(startedHelperCount);
+
     this->collectionState = CollectionStateConcurrentMark;
 }
 #endif
@@ -2849,12 +2910,24 @@ Recycler::EndMark()
     parallelMarkContext1.Cleanup();
     parallelMarkContext2.Cleanup();
     parallelMarkContext3.Cleanup();
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->markContext.Cleanup();
+    }
+#endif
 
     // Decommit all pages
     markContext.DecommitPages();
     parallelMarkContext1.DecommitPages();
     parallelMarkContext2.DecommitPages();
     parallelMarkContext3.DecommitPages();
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->markContext.DecommitPages();
+    }
+#endif
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2947,6 +3020,12 @@ Recycler::EndMarkOnLowMemory()
     Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
     Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
     Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        Assert(!this->parallelMarkHelpers[i]->markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
+    }
+#endif
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2971,10 +3050,64 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    if (!(markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty()))
+    {
+        return false;
+    }
+
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        if (!this->parallelMarkHelpers[i]->markContext.IsEmpty())
+        {
+            return false;
+        }
+    }
+#endif
+    return true;
 }
 #endif
 
+bool
+Recycler::HasPendingMarkObjects() const
+{
+    if (markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects())
+    {
+        return true;
+    }
+
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        if (this->parallelMarkHelpers[i]->markContext.HasPendingMarkObjects())
+        {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+bool
+Recycler::HasPendingTrackObjects() const
+{
+    if (markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects())
+    {
+        return true;
+    }
+
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        if (this->parallelMarkHelpers[i]->markContext.HasPendingTrackObjects())
+        {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
 #ifdef HEAP_ENUMERATION_VALIDATION
 void
 Recycler::PostHeapEnumScan(PostHeapEnumScanCallback callback, void *data)
@@ -3680,7 +3813,7 @@ Recycler::CollectWithHeuristic()
         {
             Assert(enablePartialCollect);
             Assert(allocSize);
-            Assert(this->uncollectedNewPageCountPartialCollect >= RecyclerSweep::MinPartialUncollectedNewPageCount
+            Assert(this->uncollectedNewPageCountPartialCollect >= RecyclerSweep::GetMinPartialUncollectedNewPageCount(GetRecyclerFlagsTable())
                 && this->uncollectedNewPageCountPartialCollect <= RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount);
 
             // PARTIAL-GC-REVIEW: For now, we have only alloc size heuristic
@@ -4100,6 +4233,9 @@ Recycler::PartialCollect(bool concurrent)
     Assert(IsMarkStackEmpty());
     Assert(this->inPartialCollectMode);
     Assert(collectionState == CollectionStateNotCollecting);
+
+    this->partialCollectCount++;
+
     // Rescan again
     collectionState = CollectionStateRescanFindRoots;
 #if ENABLE_CONCURRENT_GC
@@ -4183,6 +4319,7 @@ Recycler::ClearPartialCollect()
     this->partialUncollectedAllocBytes = 0;
     this->clientTrackedObjectList.Clear(&this->clientTrackedObjectAllocator);
     this->uncollectedNewPageCountPartialCollect = (size_t)-1;
+    this->partialCollectCount = 0;
 }
 
 void
@@ -4409,6 +4546,10 @@ Recycler::ProcessTrackedObjects()
     parallelMarkContext1.ProcessTracked();
     parallelMarkContext2.ProcessTracked();
     parallelMarkContext3.ProcessTracked();
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->markContext.ProcessTracked();
+    }
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4955,6 +5096,10 @@ Recycler::FinalizeConcurrent(bool restoreState)
     // close it.
     parallelThread1.Shutdown();
     parallelThread2.Shutdown();
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->parallelThread.Shutdown();
+    }
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -6754,6 +6899,127 @@ Recycler::ParallelWorkFunc()
     }
 }
 
+RecyclerParallelMarkHelper::RecyclerParallelMarkHelper(Recycler * recycler, Js::ConfigFlagsTable& configFlagsTable) :
+    pagePool(configFlagsTable),
+    markContext(recycler, &this->pagePool),
+    parallelThread(recycler, &Recycler::ParallelMarkHelperWorkFunc)
+{
+    markContext.SetStealPool(&recycler->markStealPool);
+#ifdef RECYCLER_MARK_TRACK
+    markContext.SetMarkMap(recycler->markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    markContext.SetMaxPageCount(configFlagsTable.MaxMarkStackPageCount);
+#endif
+}
+
+void
+Recycler::InitializeParallelMarkHelpers()
+{
+    Assert(this->parallelMarkHelpers == nullptr);
+
+    if (this->maxParallelism <= 4)
+    {
+        return;
+    }
+
+    uint helperCount = this->maxParallelism - 4;
+    this->parallelMarkHelpers = HeapNewNoThrowArray(RecyclerParallelMarkHelper *, helperCount);
+    if (this->parallelMarkHelpers == nullptr)
+    {
+        // Not fatal; we just mark with the fixed four-way split.
+        this->maxParallelism = 4;
+        return;
+    }
+
+    // If we run out of memory part way, we just run with fewer helpers.
+    while (this->parallelMarkHelperCount < helperCount)
+    {
+        RecyclerParallelMarkHelper * helper = HeapNewNoThrow(RecyclerParallelMarkHelper, this, GetRecyclerFlagsTable());
+        if (helper == nullptr)
+        {
+            break;
+        }
+        this->parallelMarkHelpers[this->parallelMarkHelperCount++] = helper;
+    }
+}
+
+void
+Recycler::DeleteParallelMarkHelpers()
+{
+    if (this->parallelMarkHelpers == nullptr)
+    {
+        return;
+    }
+
+    // Stolen chunks can end up held by a context other than the one whose page allocator they came from,
+    // so release every context before deleting any of the helpers' page pools.
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->markContext.Release();
+    }
+
+    for (uint i = 0; i < this->parallelMarkHelperCount; i++)
+    {
+        HeapDelete(this->parallelMarkHelpers[i]);
+    }
+
+    HeapDeleteArray(this->maxParallelism - 4, this->parallelMarkHelpers);
+    this->parallelMarkHelpers = nullptr;
+    this->parallelMarkHelperCount = 0;
+}
+
+uint
+Recycler::StartParallelMarkHelpers()
+{
+    // Helpers claim their mark context in the order they start (see ParallelMarkHelperWorkFunc).
+    this->parallelMarkHelperIndex = 0;
+
+    uint startedHelperCount = 0;
+    while (startedHelperCount < this->parallelMarkHelperCount)
+    {
+        if (!this->parallelMarkHelpers[startedHelperCount]->parallelThread.StartConcurrent())
+        {
+            break;
+        }
+        startedHelperCount++;
+    }
+    return startedHelperCount;
+}
+
+void
+Recycler::WaitForParallelMarkHelpers(uint startedHelperCount)
+{
+    for (uint i = 0; i < startedHelperCount; i++)
+    {
+        this->parallelMarkHelpers[i]->parallelThread.WaitForConcurrent();
+    }
+}
+
+void
+Recycler::ParallelMarkHelperWorkFunc()
+{
+    uint helperIndex = (uint)InterlockedIncrement(&this->parallelMarkHelperIndex) - 1;
+    Assert(helperIndex < this->parallelMarkHelperCount);
+
+    MarkContext * markContext = &this->parallelMarkHelpers[helperIndex]->markContext;
+    Assert(!markContext->HasPendingMarkObjects());
+
+    switch (this->collectionState)
+    {
+        case CollectionStateParallelMark:
+            this->ProcessParallelMark(false, markContext);
+            break;
+
+        case CollectionStateBackgroundParallelMark:
+            this->ProcessParallelMark(true, markContext);
+            break;
+
+        default:
+            Assert(false);
+    }
+}
+
 void
 RecyclerParallelThread::WaitForConcurrent()
 {
@@ -623,6 +623,19 @@ class RecyclerParallelThread
     HANDLE concurrentThread;
     bool synchronizeOnStartup;
 };
+
+// Marker thread beyond the fixed four-way split of the mark stack.
+// Helpers start every parallel mark with an empty mark stack and get all of their work
+// by stealing chunks that the other markers donate to the recycler's steal pool.
+class RecyclerParallelMarkHelper
+{
+public:
+    RecyclerParallelMarkHelper(Recycler * recycler, Js::ConfigFlagsTable& configFlagsTable);
+
+    PagePool pagePool;
+    MarkContext markContext;
+    RecyclerParallelThread parallelThread;
+};
 #endif
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -648,6 +661,7 @@ class Recycler
     friend class HeapBlockMap32;
 #if ENABLE_CONCURRENT_GC
     friend class RecyclerParallelThread;
+    friend class RecyclerParallelMarkHelper;
 #endif
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     friend class AutoProtectPages;
@@ -861,8 +875,8 @@ class Recycler
     PagePool parallelMarkPagePool3;
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const;
+    bool HasPendingTrackObjects() const;
 
     RecyclerCollectionWrapper * collectionWrapper;
 
@@ -998,6 +1012,20 @@ class Recycler
     RecyclerParallelThread parallelThread1;
     RecyclerParallelThread parallelThread2;
 
+    // Work stealing between markers, and the extra markers used when maxParallelism is above 4.
+    // See RecyclerParallelMarkHelper.
+    static const uint MaxParallelMarkThreadCount = 64;
+    MarkContext::MarkStealPool markStealPool;
+    RecyclerParallelMarkHelper ** parallelMarkHelpers;
+    uint parallelMarkHelperCount;
+    volatile LONG parallelMarkHelperIndex;
+
+    void InitializeParallelMarkHelpers();
+    void DeleteParallelMarkHelpers();
+    uint StartParallelMarkHelpers();
+    void WaitForParallelMarkHelpers(uint startedHelperCount);
+    void ParallelMarkHelperWorkFunc();
+
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
     // If the concurrent thread hasn't started yet, this is set to true
@@ -1042,6 +1070,10 @@ class Recycler
 
     // Dynamic Heuristics for partial GC
     size_t uncollectedNewPageCountPartialCollect;
+
+    // Number of partial collects done since the last full collect.
+    // Bounded by RecyclerMaxPartialCollectCount, after which everything that survived gets a full mark again.
+    uint partialCollectCount;
 #endif
 
     uint tickCountNextCollection;
@@ -636,6 +636,37 @@ RecyclerSweep::SubtractSweepNewObjectAllocBytes(size_t newObjectExpectSweepByteC
 }
 
 
+/*--------------------------------------------------------------------------------------------
+ * Nursery sizing for partial collect.
+ * Objects that survive a collect keep their mark bits while we are in partial collect mode, so
+ * a partial collect only marks and sweeps what was allocated since the last collect (plus what the
+ * write watch / write barrier reports as modified). With -RecyclerNurserySize, a partial collect is
+ * triggered every time that much new memory has been allocated, instead of the adaptive 4MB+ threshold.
+ *--------------------------------------------------------------------------------------------*/
+size_t
+RecyclerSweep::GetNurseryPageCount(Js::ConfigFlagsTable& flags)
+{
+    if (flags.RecyclerNurserySize <= 0)
+    {
+        return 0;
+    }
+
+    size_t nurseryPageCount = ((size_t)flags.RecyclerNurserySize KILOBYTES) / AutoSystemInfo::PageSize;
+    if (nurseryPageCount == 0)
+    {
+        return 1;
+    }
+
+    return min(nurseryPageCount, (size_t)RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount);
+}
+
+size_t
+RecyclerSweep::GetMinPartialUncollectedNewPageCount(Js::ConfigFlagsTable& flags)
+{
+    size_t nurseryPageCount = GetNurseryPageCount(flags);
+    return nurseryPageCount != 0 ? nurseryPageCount : MinPartialUncollectedNewPageCount;
+}
+
 /*--------------------------------------------------------------------------------------------
  * Determine we want to go into partial collect mode for the next GC before we sweep,
  * based on the number bytes needed to rescan (<= 5MB)
@@ -655,6 +686,14 @@ RecyclerSweep::DoPartialCollectMode()
         return false;
     }
 
+    // Objects that survive a partial collect are only reclaimed by a full collect,
+    // so bound the number of partial collects we do in a row.
+    const int maxPartialCollectCount = recycler->GetRecyclerFlagsTable().RecyclerMaxPartialCollectCount;
+    if (maxPartialCollectCount > 0 && recycler->partialCollectCount >= (uint)maxPartialCollectCount)
+    {
+        return false;
+    }
+
     return this->rescanRootBytes <= MaxPartialCollectRescanRootBytes;
 }
 
@@ -754,11 +793,20 @@ RecyclerSweep::AdjustPartialHeuristics()
     }
     Assert(0.0 <= ratio && ratio <= 1.0);
 
-    // Linear scale the partial GC new page heuristic using the ratio calculated
-    recycler->uncollectedNewPageCountPartialCollect = MinPartialUncollectedNewPageCount
-        + (size_t)((double)(RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount - MinPartialUncollectedNewPageCount) * ratio);
+    const size_t nurseryPageCount = GetNurseryPageCount(recycler->GetRecyclerFlagsTable());
+    if (nurseryPageCount != 0)
+    {
+        // Fixed size nursery: collect the new objects every time the nursery fills up
+        recycler->uncollectedNewPageCountPartialCollect = nurseryPageCount;
+    }
+    else
+    {
+        // Linear scale the partial GC new page heuristic using the ratio calculated
+        recycler->uncollectedNewPageCountPartialCollect = MinPartialUncollectedNewPageCount
+            + (size_t)((double)(RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount - MinPartialUncollectedNewPageCount) * ratio);
+    }
 
-    Assert(recycler->uncollectedNewPageCountPartialCollect >= MinPartialUncollectedNewPageCount &&
+    Assert(recycler->uncollectedNewPageCountPartialCollect >= GetMinPartialUncollectedNewPageCount(recycler->GetRecyclerFlagsTable()) &&
         recycler->uncollectedNewPageCountPartialCollect <= RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount);
 
     // If the number of new page to reach the partial heuristics plus the existing uncollectedAllocBytes
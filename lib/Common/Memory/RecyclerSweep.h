@@ -75,6 +75,9 @@ class RecyclerSweep
 
     static const uint MinPartialUncollectedNewPageCount; // 4MB pages
     static const uint MaxPartialCollectRescanRootBytes; // 5MB
+
+    static size_t GetNurseryPageCount(Js::ConfigFlagsTable& flags);
+    static size_t GetMinPartialUncollectedNewPageCount(Js::ConfigFlagsTable& flags);
 #endif
 
 private:
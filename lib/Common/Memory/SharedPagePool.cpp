@@ -0,0 +1,115 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+
+#if ENABLE_SHARED_PAGE_POOL
+SharedPagePool SharedPagePool::Instance;
+
+SharedPagePool::SharedPagePool() :
+    pageCount(0)
+{
+    for (uint i = 0; i < BinCount; i++)
+    {
+        ::InitializeSListHead(&bins[i]);
+    }
+}
+
+bool
+SharedPagePool::GetBinIndex(size_t pageCount, bool enableWriteBarrier, uint * binIndex)
+{
+    if (!Math::IsPow2(pageCount))
+    {
+        return false;
+    }
+
+    uint log2 = Math::Log2((uint32)pageCount);
+    if (log2 > MaxPageCountLog2)
+    {
+        return false;
+    }
+
+    *binIndex = log2 * 2 + (enableWriteBarrier ? 1 : 0);
+    return true;
+}
+
+bool
+SharedPagePool::ReserveCapacity(size_t pageCount)
+{
+    uint binIndex;
+    if (!GetBinIndex(pageCount, false, &binIndex))
+    {
+        return false;
+    }
+
+    LONG maxPageCount = GetMaxPageCount();
+    while (true)
+    {
+        LONG currentPageCount = this->pageCount;
+        LONG newPageCount = currentPageCount + (LONG)pageCount;
+        if (newPageCount > maxPageCount)
+        {
+            return false;
+        }
+
+        if (::InterlockedCompareExchange(&this->pageCount, newPageCount, currentPageCount) == currentPageCount)
+        {
+            return true;
+        }
+    }
+}
+
+void
+SharedPagePool::Add(__in char * address, size_t pageCount, bool enableWriteBarrier)
+{
+    uint binIndex;
+    bool validBin = GetBinIndex(pageCount, enableWriteBarrier, &binIndex);
+    Assert(validBin);
+    Assert(((ULONG_PTR)address % (64 * 1024)) == 0);
+
+    PooledSegment * pooledSegment = (PooledSegment *)address;
+    pooledSegment->pageCount = pageCount;
+    ::InterlockedPushEntrySList(&bins[binIndex], &pooledSegment->entry);
+}
+
+char *
+SharedPagePool::Take(size_t pageCount, bool enableWriteBarrier)
+{
+    uint binIndex;
+    if (!GetBinIndex(pageCount, enableWriteBarrier, &binIndex))
+    {
+        return nullptr;
+    }
+
+    PooledSegment * pooledSegment = (PooledSegment *)::InterlockedPopEntrySList(&bins[binIndex]);
+    if (pooledSegment == nullptr)
+    {
+        return nullptr;
+    }
+
+    Assert(pooledSegment->pageCount == pageCount);
+    ::InterlockedExchangeAdd(&this->pageCount, -(LONG)pageCount);
+
+    // Pooled pages are zeroed, except for the pool's own bookkeeping
+    memset(pooledSegment, 0, sizeof(PooledSegment));
+    return (char *)pooledSegment;
+}
+
+void
+SharedPagePool::Flush()
+{
+    for (uint i = 0; i < BinCount; i++)
+    {
+        PooledSegment * pooledSegment = (PooledSegment *)::InterlockedFlushSList(&bins[i]);
+        while (pooledSegment != nullptr)
+        {
+            PooledSegment * next = (PooledSegment *)pooledSegment->entry.Next;
+            size_t segmentPageCount = pooledSegment->pageCount;
+            ::InterlockedExchangeAdd(&this->pageCount, -(LONG)segmentPageCount);
+            VirtualAllocWrapper::Instance.Free(pooledSegment, segmentPageCount * AutoSystemInfo::PageSize, MEM_RELEASE);
+            pooledSegment = next;
+        }
+    }
+}
+#endif
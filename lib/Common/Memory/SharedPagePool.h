@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_SHARED_PAGE_POOL
+namespace Memory
+{
+/*
+ * SharedPagePool is a process-wide cache of committed, zeroed page segments.
+ * When a page allocator would release an empty segment back to the OS, it can
+ * hand the memory to the pool instead, and any other page allocator in the
+ * process (typically one owned by another runtime) can pick it up instead of
+ * reserving and committing a new segment.
+ *
+ * Segments are binned by page count (always a power of 2) and by whether the
+ * write barrier is enabled on them. Each bin is an interlocked SList whose
+ * entry lives in the first bytes of the pooled memory itself, so the pool
+ * needs no allocation of its own. The entry is zeroed again before the memory
+ * is handed out.
+ */
+class SharedPagePool
+{
+public:
+    static SharedPagePool Instance;
+
+    static bool IsEnabled() { return GetMaxPageCount() != 0; }
+
+    // Claim room in the pool for pageCount pages; must be followed by Add.
+    bool ReserveCapacity(size_t pageCount);
+    void Add(__in char * address, size_t pageCount, bool enableWriteBarrier);
+    char * Take(size_t pageCount, bool enableWriteBarrier);
+
+    // Release all pooled memory to the OS
+    void Flush();
+
+    size_t GetPageCount() const { return (size_t)this->pageCount; }
+
+private:
+    SharedPagePool();
+
+    struct PooledSegment
+    {
+        SLIST_ENTRY entry;
+        size_t pageCount;
+    };
+
+#if TARGET_32
+    static const uint MaxPageCountLog2 = 12;        // 16 MB segments
+#else
+    static const uint MaxPageCountLog2 = 14;        // 64 MB segments
+#endif
+    static const uint BinCount = (MaxPageCountLog2 + 1) * 2;
+
+    static LONG GetMaxPageCount() { return (LONG)CONFIG_FLAG_RELEASE(SharedPagePoolMaxPageCount); }
+    static bool GetBinIndex(size_t pageCount, bool enableWriteBarrier, uint * binIndex);
+
+    SLIST_HEADER bins[BinCount];
+    LONG volatile pageCount;
+};
+};
+#endif
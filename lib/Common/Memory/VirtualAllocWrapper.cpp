@@ -78,18 +78,108 @@ LPVOID VirtualAllocWrapper::AllocPages(LPVOID lpAddress, size_t pageCount, DWORD
         }
     }
 
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    if (isCustomHeapAllocation && (allocationType & MEM_RESERVE) != 0)
+    {
+        CodeRegionTable::Add(address, dwSize);
+    }
+#endif
+
     return address;
 }
 
 BOOL VirtualAllocWrapper::Free(LPVOID lpAddress, size_t dwSize, DWORD dwFreeType)
 {
     AnalysisAssert(dwFreeType == MEM_RELEASE || dwFreeType == MEM_DECOMMIT);
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    if (dwFreeType == MEM_RELEASE)
+    {
+        // Unlist the region before the address range can be reused
+        CodeRegionTable::Remove(lpAddress);
+    }
+#endif
     size_t bytes = (dwFreeType == MEM_RELEASE)? 0 : dwSize;
 #pragma warning(suppress: 28160) // Calling VirtualFreeEx without the MEM_RELEASE flag frees memory but not address descriptors (VADs)
     BOOL ret = VirtualFree(lpAddress, bytes, dwFreeType);
     return ret;
 }
 
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+/*
+* class CodeRegionTable
+*/
+CodeRegionTable::Region CodeRegionTable::regions[CodeRegionTable::MaxRegionCount];
+volatile uint CodeRegionTable::regionLimit = 0;
+volatile bool CodeRegionTable::hasOverflowed = false;
+
+void CodeRegionTable::Add(void * address, size_t size)
+{
+    Assert(address != nullptr && size != 0);
+    for (uint i = 0; i < MaxRegionCount; i++)
+    {
+        if (regions[i].start != nullptr ||
+            InterlockedCompareExchangePointer(&regions[i].start, address, nullptr) != nullptr)
+        {
+            continue;
+        }
+
+        regions[i].size = size;
+
+        uint limit = regionLimit;
+        while (limit <= i)
+        {
+            uint previous = (uint)::InterlockedCompareExchange((volatile LONG *)&regionLimit, i + 1, limit);
+            if (previous == limit)
+            {
+                break;
+            }
+            limit = previous;
+        }
+        return;
+    }
+
+    // Too many regions to track, so every fault has to go through the full check
+    hasOverflowed = true;
+}
+
+void CodeRegionTable::Remove(void * address)
+{
+    uint limit = regionLimit;
+    for (uint i = 0; i < limit; i++)
+    {
+        if (regions[i].start == address)
+        {
+            regions[i].size = 0;
+            MemoryBarrier();
+            regions[i].start = nullptr;
+            return;
+        }
+    }
+}
+
+// Called from the SIGSEGV handler; it must not take any lock or allocate.
+// A slot can be reused while it is being read, but not the slot of a region that code is running in,
+// so a stale read can only turn an unrelated fault into a false positive, which the full check then rejects.
+bool CodeRegionTable::Contains(void * address)
+{
+    if (hasOverflowed)
+    {
+        return true;
+    }
+
+    uint limit = regionLimit;
+    for (uint i = 0; i < limit; i++)
+    {
+        char * start = (char *)regions[i].start;
+        if (start != nullptr && (char *)address >= start && (char *)address < start + regions[i].size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
 /*
 * class PreReservedVirtualAllocWrapper
 */
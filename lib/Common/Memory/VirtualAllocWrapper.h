@@ -32,6 +32,34 @@ class VirtualAllocWrapper
     VirtualAllocWrapper() {}
 };
 
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+/*
+* CodeRegionTable is a lock-free, process wide record of the regions reserved for the custom (JIT code) heap.
+* The SIGSEGV handler runs in whatever state the faulting thread was in, so it checks this table before doing any
+* work that may take a lock: a fault outside of JIT'd code is never an out of bounds array access.
+*/
+class CodeRegionTable
+{
+public:
+    static void Add(void * address, size_t size);
+    static void Remove(void * address);
+    static bool Contains(void * address);
+
+private:
+    static const uint MaxRegionCount = 4096;
+
+    struct Region
+    {
+        void * volatile start;
+        volatile size_t size;   // 0 while the slot is being filled in
+    };
+
+    static Region regions[MaxRegionCount];
+    static volatile uint regionLimit;   // No slot at or above this index was ever used
+    static volatile bool hasOverflowed;
+};
+#endif
+
 /*
 * PreReservedVirtualAllocWrapper class takes care of Reserving a large memory region initially
 * and then committing mem regions for the size requested.
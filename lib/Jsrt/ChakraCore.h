@@ -42,6 +42,39 @@ typedef void* JsModuleRecord;
 /// </remarks>
 typedef void *JsSharedArrayBufferContentHandle;
 
+/// <summary>
+///     A JSON parse session created by JsCreateJsonParseSession.
+/// </summary>
+typedef void *JsJsonParseSessionHandle;
+
+/// <summary>
+///     How a JSON parse session splits its input into values.
+/// </summary>
+typedef enum JsJsonParseMode
+{
+    /// <summary>
+    ///     The input is a sequence of top-level values separated by whitespace, such as
+    ///     newline-delimited JSON. Each top-level value is returned when it is complete.
+    /// </summary>
+    JsJsonParseMode_Values = 0,
+    /// <summary>
+    ///     The input is a single top-level array. Each element of the array is returned when it
+    ///     is complete; the array itself is never created.
+    /// </summary>
+    JsJsonParseMode_ArrayElements = 1
+} JsJsonParseMode;
+
+/// <summary>
+///     Receives the output of JsJsonStringifyUtf8 a chunk at a time.
+/// </summary>
+/// <param name="chunk">
+///     The next bytes of UTF-8 JSON text. The bytes are only valid for the duration of the call.
+///     A chunk never ends in the middle of a character.
+/// </param>
+/// <param name="length">The number of bytes in chunk.</param>
+/// <param name="callbackState">The state passed to <c>JsJsonStringifyUtf8</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsJsonStringifyWriteCallback)(_In_reads_bytes_(length) const char *chunk, _In_ size_t length, _In_opt_ void *callbackState);
+
 typedef enum JsParseModuleSourceFlags
 {
     JsParseModuleSourceFlags_DataIsUTF16LE = 0x00000000,
@@ -577,6 +610,12 @@ CHAKRA_API
 ///     <para>
 ///     Requires an active script context.
 ///     </para>
+///     <para>
+///     The runtime never writes to the buffer; it executes byte code directly out of it and
+///     deserializes each function the first time it is called. An ExternalArrayBuffer over a
+///     read-only file mapping (unmapped in its finalize callback) lets processes running the same
+///     serialized script share its pages.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">
@@ -612,6 +651,12 @@ CHAKRA_API
 ///     The runtime will hold on to the buffer until all instances of any functions created from
 ///     the buffer are garbage collected.
 ///     </para>
+///     <para>
+///     The runtime never writes to the buffer; it executes byte code directly out of it and
+///     deserializes each function the first time it is called. An ExternalArrayBuffer over a
+///     read-only file mapping (unmapped in its finalize callback) lets processes running the same
+///     serialized script share its pages.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
@@ -1052,5 +1097,133 @@ CHAKRA_API
     JsGetModuleNamespace(
         _In_ JsModuleRecord requestModule,
         _Outptr_result_maybenull_ JsValueRef *moduleNamespace);
+
+/// <summary>
+///     Creates a session that parses UTF-8 JSON text fed to it in chunks.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context. The session parses into that script context and may
+///     only be used while it is current.
+///     </para>
+///     <para>
+///     Only the text of the value in progress is buffered; each value is parsed as soon as its
+///     last byte arrives and its text is dropped. Memory use is therefore bounded by the largest
+///     value rather than by the whole input.
+///     </para>
+/// </remarks>
+/// <param name="mode">Which values of the input are returned.</param>
+/// <param name="session">The new session. Release it with JsReleaseJsonParseSession.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateJsonParseSession(
+        _In_ JsJsonParseMode mode,
+        _Out_ JsJsonParseSessionHandle *session);
+
+/// <summary>
+///     Feeds the next chunk of UTF-8 JSON text to a parse session.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Chunks may split the text anywhere, including inside a value or a multi-byte character.
+///     Values completed by this chunk are available from JsJsonParseSessionGetNextValue.
+///     If the text is not valid JSON, a SyntaxError is set as the exception and
+///     <c>JsErrorScriptException</c> is returned; the session can't be fed after that.
+///     </para>
+/// </remarks>
+/// <param name="session">The parse session.</param>
+/// <param name="chunk">The next bytes of the input. The session makes its own copy.</param>
+/// <param name="length">The number of bytes in chunk.</param>
+/// <param name="isLastChunk">
+///     Whether this is the end of the input. A value that is still incomplete at that point is a
+///     syntax error.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsJsonParseSessionAddChunk(
+        _In_ JsJsonParseSessionHandle session,
+        _In_reads_bytes_(length) const char *chunk,
+        _In_ size_t length,
+        _In_ bool isLastChunk);
+
+/// <summary>
+///     Takes the next completed value from a parse session.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. Values are returned in input order.
+/// </remarks>
+/// <param name="session">The parse session.</param>
+/// <param name="value">
+///     The next completed value, or <c>JS_INVALID_REFERENCE</c> if every completed value has
+///     already been taken.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsJsonParseSessionGetNextValue(
+        _In_ JsJsonParseSessionHandle session,
+        _Out_ JsValueRef *value);
+
+/// <summary>
+///     Releases a parse session and any completed values that were not taken.
+/// </summary>
+/// <remarks>
+///     Requires an active script context, the same one the session was created in.
+/// </remarks>
+/// <param name="session">The parse session.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsReleaseJsonParseSession(
+        _In_ JsJsonParseSessionHandle session);
+
+/// <summary>
+///     Converts a value to JSON text the way <c>JSON.stringify</c> does and writes it out as UTF-8.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The text is encoded straight from the stringified value a few KB at a time and handed to
+///     writeCallback, so the whole JSON string is never created as a JavaScript string. Unpaired
+///     surrogates are written as U+FFFD, as JsCopyString does. If the value has no JSON
+///     representation (for example undefined or a function), nothing is written.
+///     </para>
+///     <para>
+///     A toJSON method or replacer function that throws causes <c>JsErrorScriptException</c> to
+///     be returned before anything is written.
+///     </para>
+/// </remarks>
+/// <param name="value">The value to stringify.</param>
+/// <param name="replacer">
+///     The replacer argument of <c>JSON.stringify</c>, or <c>JS_INVALID_REFERENCE</c> for none.
+/// </param>
+/// <param name="space">
+///     The space argument of <c>JSON.stringify</c>, or <c>JS_INVALID_REFERENCE</c> for none.
+/// </param>
+/// <param name="writeCallback">The callback that receives the output.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <param name="length">The total number of bytes written. Optional.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsJsonStringifyUtf8(
+        _In_ JsValueRef value,
+        _In_opt_ JsValueRef replacer,
+        _In_opt_ JsValueRef space,
+        _In_ JsJsonStringifyWriteCallback writeCallback,
+        _In_opt_ void *callbackState,
+        _Out_opt_ size_t *length);
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
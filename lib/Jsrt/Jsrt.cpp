@@ -14,8 +14,11 @@
 #include "Library/DataView.h"
 #include "Library/JavascriptExceptionMetadata.h"
 #include "Library/JavascriptPromise.h"
+#include "Library/JSONStreamParser.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
+#include "Language/PersistentProfileCache.h"
+#include "Language/SourceDynamicProfileManager.h"
 
 // Parser Includes
 #include "cmperr.h"     // For ERRnoMemory
@@ -3458,6 +3461,12 @@ JsErrorCode RunScriptCore(JsValueRef scriptSource, const byte *script, size_t cb
         if (sourceContextInfo == nullptr)
         {
             sourceContextInfo = scriptContext->CreateSourceContextInfo(sourceContext, sourceUrl, wcslen(sourceUrl), nullptr);
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+            if (PersistentProfileCache::IsEnabled() && sourceContextInfo->sourceDynamicProfileManager != nullptr)
+            {
+                sourceContextInfo->sourceDynamicProfileManager->LoadFromPersistentProfileCache(script, cb, sourceContextInfo->url);
+            }
+#endif
         }
 
         const int chsize = (loadScriptFlag & LoadScriptFlag_Utf8Source) ?
@@ -4661,8 +4670,17 @@ CHAKRA_API JsCreateString(
 
     return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
 
-        Js::JavascriptString *stringValue = Js::LiteralStringWithPropertyStringPtr::
-            NewFromCString(content, (CharCount)length, scriptContext->GetLibrary());
+        // ASCII content is kept one byte per character until something needs it as char16
+        Js::JavascriptString *stringValue = nullptr;
+        if (length > 1)
+        {
+            stringValue = Js::OneByteString::TryNewFromAsciiCString(content, (CharCount)length, scriptContext->GetLibrary());
+        }
+        if (stringValue == nullptr)
+        {
+            stringValue = Js::LiteralStringWithPropertyStringPtr::
+                NewFromCString(content, (CharCount)length, scriptContext->GetLibrary());
+        }
 
         PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, stringValue->GetSz(), stringValue->GetLength());
 
@@ -4785,6 +4803,18 @@ CHAKRA_API JsCopyString(
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
 
+    Js::OneByteString *oneByteString = Js::OneByteString::TryFromVar(value);
+    if (oneByteString != nullptr)
+    {
+        // Copy out of the one-byte buffer without widening the string
+        size_t utf8Length = oneByteString->CopyToUtf8(buffer, bufferSize);
+        if (length)
+        {
+            *length = utf8Length;
+        }
+        return JsNoError;
+    }
+
     const char16* str = nullptr;
     size_t strLength = 0;
     JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
@@ -5332,4 +5362,136 @@ CHAKRA_API JsSetHostPromiseRejectionTracker(_In_ JsHostPromiseRejectionTrackerCa
     /*allowInObjectBeforeCollectCallback*/true);
 }
 
+CHAKRA_API JsCreateJsonParseSession(_In_ JsJsonParseMode mode, _Out_ JsJsonParseSessionHandle *session)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(session);
+        *session = nullptr;
+
+        if (mode != JsJsonParseMode_Values && mode != JsJsonParseMode_ArrayElements)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *session = HeapNew(JSON::JSONStreamParser, scriptContext,
+            mode == JsJsonParseMode_Values ? JSON::JSONStreamParser::Values : JSON::JSONStreamParser::ArrayElements);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsJsonParseSessionAddChunk(_In_ JsJsonParseSessionHandle session, _In_reads_bytes_(length) const char *chunk,
+    _In_ size_t length, _In_ bool isLastChunk)
+{
+    return ContextAPIWrapper_NoRecord<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(session);
+        if (chunk == nullptr && length > 0)
+        {
+            return JsErrorNullArgument;
+        }
+
+        JSON::JSONStreamParser* streamParser = static_cast<JSON::JSONStreamParser*>(session);
+        if (streamParser->GetScriptContext() != scriptContext || streamParser->HasFailed() || streamParser->IsComplete())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        streamParser->AddChunk(reinterpret_cast<const byte*>(chunk), length, isLastChunk);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsJsonParseSessionGetNextValue(_In_ JsJsonParseSessionHandle session, _Out_ JsValueRef *value)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(session);
+        PARAM_NOT_NULL(value);
+        *value = JS_INVALID_REFERENCE;
+
+        JSON::JSONStreamParser* streamParser = static_cast<JSON::JSONStreamParser*>(session);
+        if (streamParser->GetScriptContext() != scriptContext)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::Var nextValue = streamParser->GetNextValue();
+        if (nextValue != nullptr)
+        {
+            *value = nextValue;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsReleaseJsonParseSession(_In_ JsJsonParseSessionHandle session)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(session);
+
+        JSON::JSONStreamParser* streamParser = static_cast<JSON::JSONStreamParser*>(session);
+        if (streamParser->GetScriptContext() != scriptContext)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        HeapDelete(streamParser);
+        return JsNoError;
+    });
+}
+
+
+class JsrtJsonUtf8Writer : public Js::JSONUtf8Writer
+{
+private:
+    JsJsonStringifyWriteCallback writeCallback;
+    void *callbackState;
+
+protected:
+    void WriteChunk(_In_reads_bytes_(length) const byte* chunk, size_t length) override
+    {
+        this->writeCallback(reinterpret_cast<const char*>(chunk), length, this->callbackState);
+    }
+
+public:
+    JsrtJsonUtf8Writer(JsJsonStringifyWriteCallback writeCallback, void *callbackState) :
+        writeCallback(writeCallback), callbackState(callbackState)
+    {
+    }
+};
+
+CHAKRA_API JsJsonStringifyUtf8(_In_ JsValueRef value, _In_opt_ JsValueRef replacer, _In_opt_ JsValueRef space,
+    _In_ JsJsonStringifyWriteCallback writeCallback, _In_opt_ void *callbackState, _Out_opt_ size_t *length)
+{
+    return ContextAPIWrapper_NoRecord<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        PARAM_NOT_NULL(writeCallback);
+        if (replacer != JS_INVALID_REFERENCE)
+        {
+            VALIDATE_INCOMING_REFERENCE(replacer, scriptContext);
+        }
+        if (space != JS_INVALID_REFERENCE)
+        {
+            VALIDATE_INCOMING_REFERENCE(space, scriptContext);
+        }
+        if (length != nullptr)
+        {
+            *length = 0;
+        }
+
+        Js::LazyJSONString* json = Js::JSONStringifier::Stringify(scriptContext, value, replacer, space);
+        if (json == nullptr)
+        {
+            // No JSON representation (undefined, a function or a symbol), so there is no output
+            return JsNoError;
+        }
+
+        JsrtJsonUtf8Writer writer(writeCallback, callbackState);
+        json->WriteUtf8(&writer);
+
+        if (length != nullptr)
+        {
+            *length = writer.GetWrittenByteCount();
+        }
+        return JsNoError;
+    });
+}
 #endif // _CHAKRACOREBUILD
@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
 #include "FormalsUtil.h"
+#include "../Runtime/Language/PersistentProfileCache.h"
 #include "../Runtime/Language/SourceDynamicProfileManager.h"
 
 #if DBG_DUMP
@@ -87,6 +88,7 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
     m_isInBackground(isBackground),
     m_hasParallelJob(false),
     m_doingFastScan(false),
+    m_doParallelParse(isBackground || PHASE_ON1(Js::ParallelParsePhase)),
 #endif
     m_nextBlockId(0),
     // use the GuestArena directly for keeping the RegexPattern* alive during byte code generation
@@ -105,6 +107,12 @@ Parser::Parser(Js::ScriptContext* scriptContext, BOOL strictMode, PageAllocator
     m_currentNodeProg(nullptr),
     m_currDeferredStub(nullptr),
     m_prevSiblingDeferredStub(nullptr),
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+    m_cachedFunctionExtents(nullptr),
+    m_cachedFunctionExtentCount(0),
+    m_functionExtentsSourceHash(0),
+    m_recordedFunctionExtents(nullptr),
+#endif
     m_pCurrentAstSize(nullptr),
     m_ppnodeScope(nullptr),
     m_ppnodeExprScope(nullptr),
@@ -5674,7 +5682,9 @@ bool Parser::ParseFncDeclHelper(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, usho
         {
             fDeferred = true;
 
-            this->ParseTopLevelDeferredFunc(pnodeFnc, pnodeFncSave, pNameHint, fLambda, pNeedScanRCurly);
+            // Global scope functions can only reference globals, so skipping their bodies loses no closure information
+            bool fGlobalScope = buildAST && pnodeFncSave == nullptr && !fFunctionInBlock;
+            this->ParseTopLevelDeferredFunc(pnodeFnc, pnodeFncSave, pNameHint, fLambda, pNeedScanRCurly, fGlobalScope);
         }
         else
         {
@@ -5922,7 +5932,7 @@ void Parser::UpdateCurrentNodeFunc(ParseNodePtr pnodeFnc, bool fLambda)
     }
 }
 
-void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnodeFncParent, LPCOLESTR pNameHint, bool fLambda, bool *pNeedScanRCurly)
+void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnodeFncParent, LPCOLESTR pNameHint, bool fLambda, bool *pNeedScanRCurly, bool fGlobalScope)
 {
     // Parse a function body that is a transition point from building AST to doing fast syntax check.
 
@@ -5991,6 +6001,12 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
             pnodeFnc->sxFnc.SetStrictMode(true);
         }
     }
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+    else if (fGlobalScope && !fLambda && (m_cachedFunctionExtents != nullptr || m_recordedFunctionExtents != nullptr))
+    {
+        this->ParseCachedDeferredFuncBody(pnodeFnc, pNameHint);
+    }
+#endif
     else
     {
         if (fLambda && !*pNeedScanRCurly)
@@ -6026,10 +6042,133 @@ void Parser::ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnode
     this->m_deferringAST = FALSE;
 }
 
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+DeferredFunctionExtent const * Parser::FindCachedFunctionExtent(charcount_t ichMin) const
+{
+    uint lo = 0;
+    uint hi = m_cachedFunctionExtentCount;
+    while (lo < hi)
+    {
+        uint mid = lo + (hi - lo) / 2;
+        if (m_cachedFunctionExtents[mid].ichMin < ichMin)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return (lo < m_cachedFunctionExtentCount && m_cachedFunctionExtents[lo].ichMin == ichMin) ? &m_cachedFunctionExtents[lo] : nullptr;
+}
+
+void Parser::ParseCachedDeferredFuncBody(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint)
+{
+    // Same as skipping a function body with a DeferredFunctionStub, except that the stub (the extent) was
+    // saved to the persistent profile cache by a previous parse of the same source.
+    DeferredFunctionExtent const *extent = this->FindCachedFunctionExtent(pnodeFnc->ichMin);
+    if (extent != nullptr)
+    {
+        RestorePoint restorePoint;
+        restorePoint.m_ichMinTok = extent->ichMinTok;
+        restorePoint.m_ichMinLine = extent->ichMinLine;
+        restorePoint.m_cMinTokMultiUnits = (size_t)extent->cMinTokMultiUnits;
+        restorePoint.m_cMinLineMultiUnits = (size_t)extent->cMinLineMultiUnits;
+        restorePoint.m_line = extent->line;
+        restorePoint.functionIdIncrement = extent->functionIdIncrement;
+        restorePoint.lengthDecr = (size_t)extent->lengthDecr;
+        restorePoint.m_fHadEol = extent->hadEol;
+#ifdef DEBUG
+        restorePoint.m_cMultiUnits = (size_t)extent->cMultiUnits;
+#endif
+
+        if (m_pscan->IsRestorePointAt(restorePoint, _u('}')))
+        {
+            if (extent->fncFlags & kFunctionCallsEval)
+            {
+                this->MarkEvalCaller();
+            }
+            if (extent->fncFlags & kFunctionChildCallsEval)
+            {
+                pnodeFnc->sxFnc.SetChildCallsEval(true);
+            }
+            if (extent->fncFlags & kFunctionHasWithStmt)
+            {
+                pnodeFnc->sxFnc.SetHasWithStmt(true);
+            }
+
+            PHASE_PRINT_TRACE1(
+                Js::SkipNestedDeferredPhase,
+                _u("Skipping cached deferred function %d. %s: %d...%d\n"),
+                pnodeFnc->sxFnc.functionId, GetFunctionName(pnodeFnc, pNameHint), pnodeFnc->ichMin, restorePoint.m_ichMinTok);
+
+            m_pscan->SeekTo(restorePoint, m_nextFunctionId);
+            pnodeFnc->sxFnc.nestedCount = extent->nestedCount;
+            if (extent->fncFlags & kFunctionStrictMode)
+            {
+                pnodeFnc->sxFnc.SetStrictMode(true);
+            }
+            return;
+        }
+    }
+
+    size_t lengthBeforeBody = this->GetSourceLength();
+
+    ParseStmtList<false>(nullptr, nullptr, SM_DeferredParse, true /* isSourceElementList */);
+
+    if (m_recordedFunctionExtents != nullptr
+        && (m_recordedFunctionExtents->Count() == 0 || m_recordedFunctionExtents->Last().ichMin < pnodeFnc->ichMin))
+    {
+        RestorePoint restorePoint;
+        m_pscan->Capture(&restorePoint,
+                         *m_nextFunctionId - pnodeFnc->sxFnc.functionId - 1,
+                         lengthBeforeBody - this->GetSourceLength());
+
+        DeferredFunctionExtent newExtent;
+        memset(&newExtent, 0, sizeof(newExtent));
+        newExtent.ichMin = pnodeFnc->ichMin;
+        newExtent.fncFlags = pnodeFnc->sxFnc.fncFlags & (kFunctionCallsEval | kFunctionChildCallsEval | kFunctionHasWithStmt | kFunctionStrictMode);
+        newExtent.nestedCount = pnodeFnc->sxFnc.nestedCount;
+        newExtent.functionIdIncrement = restorePoint.functionIdIncrement;
+        newExtent.ichMinTok = restorePoint.m_ichMinTok;
+        newExtent.ichMinLine = restorePoint.m_ichMinLine;
+        newExtent.line = restorePoint.m_line;
+        newExtent.hadEol = restorePoint.m_fHadEol;
+        newExtent.cMinTokMultiUnits = restorePoint.m_cMinTokMultiUnits;
+        newExtent.cMinLineMultiUnits = restorePoint.m_cMinLineMultiUnits;
+        newExtent.lengthDecr = restorePoint.lengthDecr;
+#ifdef DEBUG
+        newExtent.cMultiUnits = restorePoint.m_cMultiUnits;
+#endif
+        m_recordedFunctionExtents->Add(newExtent);
+    }
+}
+
+void Parser::SaveDeferredFunctionExtents()
+{
+    if (m_recordedFunctionExtents != nullptr && m_recordedFunctionExtents->Count() != 0)
+    {
+        m_sourceContextInfo->sourceDynamicProfileManager->SaveDeferredFunctionExtents(
+            m_functionExtentsSourceHash, m_recordedFunctionExtents->GetBuffer(), m_recordedFunctionExtents->Count());
+    }
+
+    m_cachedFunctionExtents = nullptr;
+    m_cachedFunctionExtentCount = 0;
+    m_functionExtentsSourceHash = 0;
+    m_recordedFunctionExtents = nullptr;
+}
+#endif
+
 bool Parser::DoParallelParse(ParseNodePtr pnodeFnc) const
 {
 #if ENABLE_BACKGROUND_PARSING
-    if (!PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
+    if (!this->m_doParallelParse)
+    {
+        return false;
+    }
+
+    if (PHASE_ON1(Js::ParallelParsePhase) && !PHASE_ON_RAW(Js::ParallelParsePhase, m_sourceContextInfo->sourceContextId, pnodeFnc->sxFnc.functionId))
     {
         return false;
     }
@@ -9265,7 +9404,11 @@ Js::PropertyId PnPid::PropertyIdFromNameNode() const
 
 PidRefStack* Parser::PushPidRef(IdentPtr pid)
 {
+#if ENABLE_BACKGROUND_PARSING
+    if (this->m_doParallelParse)
+#else
     if (PHASE_ON1(Js::ParallelParsePhase))
+#endif
     {
         // NOTE: the phase check is here to protect perf. See OSG 1020424.
         // In some LS AST-rewrite cases we lose a lot of perf searching the PID ref stack rather
@@ -11509,6 +11652,51 @@ ParseNodePtr Parser::Parse(LPCUTF8 pszSrc, size_t offset, size_t length, charcou
     m_originalLength = length;
     m_nextFunctionId = nextFunctionId;
 
+#if ENABLE_BACKGROUND_PARSING
+    if (!this->IsBackgroundParser() && !PHASE_ON1(Js::ParallelParsePhase))
+    {
+        // Only big scripts are worth spreading over the background job threads. Each function that
+        // would be parsed up front becomes a job while this thread fast-scans past its body.
+        const size_t threshold = CONFIG_FLAG_RELEASE(ParallelParseThreshold);
+        BackgroundParser *bgp = m_scriptContext->GetBackgroundParser();
+        m_doParallelParse = threshold != 0
+            && length >= threshold
+            && m_parseType == ParseType_Upfront
+            && !PHASE_OFF1(Js::ParallelParsePhase)
+            && bgp != nullptr
+            && bgp->Processor()->ProcessesInBackground();
+    }
+#endif
+
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+    // A script seen by the persistent profile cache before can skip the bodies of the global functions that were
+    // deferred the last time it was parsed; otherwise, record them for next time. The extents are offsets into the
+    // whole script, so only an upfront parse of the global code from its start qualifies. They are keyed on the hash
+    // of the text being parsed, since the source context may have been created for a different script.
+    m_cachedFunctionExtents = nullptr;
+    m_cachedFunctionExtentCount = 0;
+    m_functionExtentsSourceHash = 0;
+    m_recordedFunctionExtents = nullptr;
+    Js::SourceDynamicProfileManager *profileManager = m_sourceContextInfo->sourceDynamicProfileManager;
+    if (profileManager != nullptr
+        && profileManager->GetPersistentProfileSourceHash() != 0
+        && isGlobalCode
+        && !isDeferred
+        && !isModuleSource
+        && !(grfscr & fscrEvalCode)
+        && m_parseType == ParseType_Upfront
+        && offset == 0
+        && charOffset == 0
+        && !this->IsBackgroundParser())
+    {
+        m_cachedFunctionExtents = profileManager->GetCachedFunctionExtents(pszSrc, length, &m_functionExtentsSourceHash, &m_cachedFunctionExtentCount);
+        if (m_cachedFunctionExtents == nullptr)
+        {
+            m_recordedFunctionExtents = Anew(&m_nodeAllocator, DeferredFunctionExtentList, &m_nodeAllocator);
+        }
+    }
+#endif
+
     if(m_parseType != ParseType_Deferred)
     {
         JS_ETW(EventWriteJSCRIPT_PARSE_METHOD_START(m_sourceContextInfo->dwHostSourceContext, GetScriptContext(), *m_nextFunctionId, 0, m_parseType, Js::Constants::GlobalFunction));
@@ -11843,6 +12031,10 @@ ParseNodePtr Parser::Parse(LPCUTF8 pszSrc, size_t offset, size_t length, charcou
     // Append block as body of pnodeProg
     FinishParseBlock(pnodeGlobalBlock);
 
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+    this->SaveDeferredFunctionExtents();
+#endif
+
     m_scriptContext->AddSourceSize(m_length);
 
     if (m_parseType != ParseType_Deferred)
@@ -77,6 +77,8 @@ struct DeferredFunctionStub;
 
 DeferredFunctionStub * BuildDeferredStubTree(ParseNode *pnodeFnc, Recycler *recycler);
 
+struct DeferredFunctionExtent;
+
 struct StmtNest;
 struct BlockInfoStack;
 struct ParseContext
@@ -205,6 +207,7 @@ class Parser
     bool                m_hasParallelJob;
     bool                m_isInBackground;
     bool                m_doingFastScan;
+    bool                m_doParallelParse;  // Hand function bodies to the BackgroundParser (see DoParallelParse)
 #endif
     int                 m_nextBlockId;
 
@@ -391,6 +394,13 @@ class Parser
     ParseNodePtr m_currentNodeProg; // current program
     DeferredFunctionStub *m_currDeferredStub;
     DeferredFunctionStub *m_prevSiblingDeferredStub;
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+    typedef JsUtil::List<DeferredFunctionExtent, ArenaAllocator> DeferredFunctionExtentList;
+    DeferredFunctionExtent const *m_cachedFunctionExtents;      // Global function bodies a previous process parsed and we can skip
+    uint m_cachedFunctionExtentCount;
+    uint64 m_functionExtentsSourceHash;                         // Hash of the source being parsed, which the extents are keyed on
+    DeferredFunctionExtentList *m_recordedFunctionExtents;      // Global function bodies to save for the next process
+#endif
     int32 * m_pCurrentAstSize;
     ParseNodePtr * m_ppnodeScope;  // function list tail
     ParseNodePtr * m_ppnodeExprScope; // function expression list tail
@@ -802,7 +812,12 @@ class Parser
     template<bool buildAST> void UpdateCurrentNodeFunc(ParseNodePtr pnodeFnc, bool fLambda);
     bool FncDeclAllowedWithoutContext(ushort flags);
     void FinishFncDecl(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint, ParseNodePtr *lastNodeRef, bool fLambda, bool skipCurlyBraces = false);
-    void ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnodeFncParent, LPCOLESTR pNameHint, bool fLambda, bool *pNeedScanRCurly = nullptr);
+    void ParseTopLevelDeferredFunc(ParseNodePtr pnodeFnc, ParseNodePtr pnodeFncParent, LPCOLESTR pNameHint, bool fLambda, bool *pNeedScanRCurly = nullptr, bool fGlobalScope = false);
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+    DeferredFunctionExtent const * FindCachedFunctionExtent(charcount_t ichMin) const;
+    void ParseCachedDeferredFuncBody(ParseNodePtr pnodeFnc, LPCOLESTR pNameHint);
+    void SaveDeferredFunctionExtents();
+#endif
     void ParseNestedDeferredFunc(ParseNodePtr pnodeFnc, bool fLambda, bool *pNeedScanRCurly, bool *pStrictModeTurnedOn);
     void CheckStrictFormalParameters();
     ParseNodePtr AddArgumentsNodeToVars(ParseNodePtr pnodeFnc);
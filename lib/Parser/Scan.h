@@ -678,6 +678,13 @@ class Scanner : public IScanner, public EncodingPolicy
     void Capture(_Out_ RestorePoint* restorePoint, uint functionIdIncrement, size_t lengthDecr);
     void SeekTo(const RestorePoint& restorePoint, uint *nextFunctionId);
 
+    // Whether a restore point captured by an earlier parse of the same source lands on the given character
+    bool IsRestorePointAt(const RestorePoint& restorePoint, OLECHAR ch) const
+    {
+        size_t iecp = restorePoint.m_ichMinTok + restorePoint.m_cMinTokMultiUnits;
+        return iecp < static_cast<size_t>(m_pchLast - m_pchBase) && m_pchBase[iecp] == ch;
+    }
+
     void SetNextStringTemplateIsTagged(BOOL value)
     {
         this->m_fNextStringTemplateIsTagged = value;
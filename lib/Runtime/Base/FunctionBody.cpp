@@ -6875,6 +6875,20 @@ namespace Js
         return !PHASE_OFF(Js::SimpleJitDynamicProfilePhase, this) && !CONFIG_FLAG(NewSimpleJit);
     }
 
+    bool FunctionBody::DoBaselineJit() const
+    {
+        // Small functions without loops compile quickly in simple JIT, and the old simple JIT profiles the code it runs. So
+        // when they get warm, they skip the profiling interpreter and jump the queue for simple JIT.
+        const uint maxByteCodeCount = CONFIG_FLAG(BaselineJitMaxByteCodeCount);
+        return
+            maxByteCodeCount != 0 &&
+            !CONFIG_FLAG(NewSimpleJit) &&
+            !Configuration::Global.flags.EnforceExecutionModeLimits &&
+            DoSimpleJit() &&
+            !GetHasLoops() &&
+            GetByteCodeCount() <= maxByteCodeCount;
+    }
+
     bool FunctionBody::DoInterpreterProfile() const
     {
 #if ENABLE_PROFILE_INFO
@@ -72,6 +72,12 @@ namespace Js
                 profilingInterpreter0Limit = 0;
             }
         }
+        else if (owner->DoBaselineJit())
+        {
+            // The old simple JIT does the profiling instead
+            simpleJitLimit += profilingInterpreter0Limit;
+            profilingInterpreter0Limit = 0;
+        }
         if (!owner->DoSimpleJit())
         {
             if (!CONFIG_FLAG(NewSimpleJit) && doInterpreterProfile)
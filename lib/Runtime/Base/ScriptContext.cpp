@@ -11,6 +11,7 @@
 
 #include "ConfigFlagsList.h"
 #include "ByteCode/ByteCodeApi.h"
+#include "ByteCode/ByteCodeDumper.h"
 #include "Library/ProfileString.h"
 #ifdef ENABLE_SCRIPT_DEBUGGING
 #include "Debug/DiagHelperMethodWrapper.h"
@@ -23,6 +24,7 @@
 #include "Base/EtwTrace.h"
 
 #include "Language/InterpreterStackFrame.h"
+#include "Language/PersistentProfileCache.h"
 #include "Language/SourceDynamicProfileManager.h"
 #include "Language/JavascriptStackWalker.h"
 #include "Language/AsmJsTypes.h"
@@ -269,6 +271,11 @@ namespace Js
         byteCodeAuxiliaryDataSize = 0;
         byteCodeAuxiliaryContextDataSize = 0;
         memset(byteCodeHistogram, 0, sizeof(byteCodeHistogram));
+        byteCodePairHistogram = nullptr;
+        if (Configuration::Global.flags.BytecodePairHist)
+        {
+            byteCodePairHistogram = HeapNewArrayZ(uint, ByteCodeDumper::OpPairCount);
+        }
 #endif
 
 #if DBG || defined(RUNTIME_DATA_COLLECTION)
@@ -1282,7 +1289,7 @@ namespace Js
         this->guestArena = this->GetRecycler()->CreateGuestArena(_u("Guest"), Throw::OutOfMemory);
 
 #if ENABLE_BACKGROUND_PARSING
-        if (PHASE_ON1(Js::ParallelParsePhase))
+        if (PHASE_ON1(Js::ParallelParsePhase) || CONFIG_FLAG_RELEASE(ParallelParseThreshold) != 0)
         {
             this->backgroundParser = BackgroundParser::New(this);
         }
@@ -5293,8 +5300,12 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
 
     void ScriptContext::SaveStartupProfileAndRelease(bool isSaveOnClose)
     {
-        // No need to save profiler info in JSRT scenario at this time.
-        if (GetThreadContext()->IsJSRT())
+        // No need to save profiler info in JSRT scenario at this time, unless the host asked for a persistent profile cache.
+        if (GetThreadContext()->IsJSRT()
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+            && !PersistentProfileCache::IsEnabled()
+#endif
+            )
         {
             return;
         }
@@ -5506,6 +5517,13 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
             Output::Print(_u("Unique opcodes: %d\n"), unique);
         }
 
+        if (byteCodePairHistogram != nullptr)
+        {
+            ByteCodeDumper::DumpOpPairHistogram(byteCodePairHistogram);
+            HeapDeleteArray(ByteCodeDumper::OpPairCount, byteCodePairHistogram);
+            byteCodePairHistogram = nullptr;
+        }
+
 #endif
 
 #if ENABLE_NATIVE_CODEGEN
@@ -674,6 +674,7 @@ namespace Js
         uint byteCodeAuxiliaryDataSize;
         uint byteCodeAuxiliaryContextDataSize;
         uint byteCodeHistogram[static_cast<uint>(OpCode::ByteCodeLast)];
+        uint * byteCodePairHistogram;       // -BytecodePairHist, indexed by ByteCodeDumper::GetOpPairIndex
         uint32 forinCache;
         uint32 forinNoCache;
 #endif
@@ -159,6 +159,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     hasCatchHandlerToUserCode(false),
     caseInvariantPropertySet(nullptr),
     entryPointToBuiltInOperationIdCache(&threadAlloc, 0),
+    libraryByteCodePropertyIdsCache(&threadAlloc, 0),
 #if ENABLE_NATIVE_CODEGEN
 #if !FLOATVAR
     codeGenNumberThreadAllocator(nullptr),
@@ -376,6 +377,11 @@ void ThreadContext::GlobalInitialize()
     {
         builtInPropertyRecords[i]->SetHash(JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(builtInPropertyRecords[i]->GetBuffer(), builtInPropertyRecords[i]->GetLength()));
     }
+
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    // Recover from out of bounds accesses to virtual array buffers in JIT'd code, for every thread
+    PAL_SetHardwareExceptionFilter(Js::JavascriptFunction::HardwareExceptionFilter);
+#endif
 }
 
 ThreadContext::~ThreadContext()
@@ -1290,7 +1296,8 @@ ThreadContext::ForceCleanPropertyMap()
 JsUtil::JobProcessor *
 ThreadContext::GetJobProcessor()
 {
-    if(bgJit && isOptimizedForManyInstances)
+    // With SharedJitThreadPool, all runtimes in the process share one pool of JIT threads sized to the machine
+    if(bgJit && (isOptimizedForManyInstances || CONFIG_FLAG_RELEASE(SharedJitThreadPool)))
     {
         return ThreadBoundThreadContextManager::GetSharedJobProcessor();
     }
@@ -4474,6 +4481,22 @@ ThreadContext::AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicTy
     this->dynamicObjectEnumeratorCacheMap.Item(dynamicType, cache);
 }
 
+Js::PropertyId *
+ThreadContext::GetLibraryByteCodePropertyIds(const byte * buffer, int propertyCount)
+{
+    Js::PropertyId * propertyIds = nullptr;
+    if (!this->libraryByteCodePropertyIdsCache.TryGetValue(buffer, &propertyIds))
+    {
+        propertyIds = AnewArray(&this->threadAlloc, Js::PropertyId, propertyCount);
+        for (int i = 0; i < propertyCount; i++)
+        {
+            propertyIds[i] = -1;
+        }
+        this->libraryByteCodePropertyIdsCache.Add(buffer, propertyIds);
+    }
+    return propertyIds;
+}
+
 InterruptPoller::InterruptPoller(ThreadContext *tc) :
     threadContext(tc),
     lastPollTick(0),
@@ -1760,6 +1760,11 @@ class ThreadContext sealed :
 private:
     JsUtil::BaseDictionary<Js::JavascriptMethod, uint, ArenaAllocator, PowerOf2SizePolicy> entryPointToBuiltInOperationIdCache;
 
+    // Property id tables of the engine's own serialized byte code (JsBuiltIn, Intl), keyed by buffer.
+    // Every script context deserializes the same static buffers, and the property ids they register
+    // are bound to this thread context, so the tables are shared by all script contexts.
+    JsUtil::BaseDictionary<const byte *, Js::PropertyId *, ArenaAllocator, PowerOf2SizePolicy> libraryByteCodePropertyIdsCache;
+
 #if ENABLE_JS_REENTRANCY_CHECK
 public:
     void SetNoJsReentrancy(bool val) { noJsReentrancy = val; }
@@ -1794,6 +1799,8 @@ class ThreadContext sealed :
         entryPointToBuiltInOperationIdCache.ResetNoDelete();
     }
 
+    Js::PropertyId * GetLibraryByteCodePropertyIds(const byte * buffer, int propertyCount);
+
     uint8 LoopDepth() const
     {
         return loopDepth;
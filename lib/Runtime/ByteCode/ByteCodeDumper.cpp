@@ -131,6 +131,64 @@ namespace Js
         Output::Flush();
     }
 
+    void ByteCodeDumper::DumpOpPairHistogram(uint const * pairHistogram)
+    {
+        // The most frequent pairs are the candidates for superinstructions
+        const uint maxPairsDumped = 100;
+
+        uint64 total = 0;
+        uint unique = 0;
+        for (uint i = 0; i < OpPairCount; i++)
+        {
+            total += pairHistogram[i];
+            if (pairHistogram[i] != 0)
+            {
+                unique++;
+            }
+        }
+
+        Output::Print(_u("ByteCode Pair Histogram\n\n"));
+        Output::Print(_u("%9llu                     Total executed pairs\n\n"), total);
+
+        uint max = UINT_MAX;
+        uint dumped = 0;
+        double pctcume = 0.0;
+        while (dumped < maxPairsDumped)
+        {
+            uint upper = 0;
+            for (uint i = 0; i < OpPairCount; i++)
+            {
+                if (pairHistogram[i] > upper && pairHistogram[i] < max)
+                {
+                    upper = pairHistogram[i];
+                }
+            }
+
+            if (upper == 0)
+            {
+                break;
+            }
+
+            max = upper;
+            for (uint i = 0; i < OpPairCount && dumped < maxPairsDumped; i++)
+            {
+                if (pairHistogram[i] == max)
+                {
+                    OpCode op = (OpCode)(i / (uint)OpCode::ByteCodeLast);
+                    OpCode nextOp = (OpCode)(i % (uint)OpCode::ByteCodeLast);
+                    double pct = ((double)max) / total;
+                    pctcume += pct;
+                    Output::Print(_u("%9u  %5.1lf  %5.1lf  %s -> %s\n"), max, pct * 100, pctcume * 100,
+                        OpCodeUtil::GetOpCodeName(op), OpCodeUtil::GetOpCodeName(nextOp));
+                    dumped++;
+                }
+            }
+        }
+
+        Output::Print(_u("\nUnique pairs: %u\n"), unique);
+        Output::Flush();
+    }
+
     void ByteCodeDumper::DumpConstantTable(FunctionBody *dumpFunction)
     {
         Output::Print(_u("    Constant Table:\n    ======== =====\n    "));
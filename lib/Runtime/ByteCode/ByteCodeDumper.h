@@ -15,6 +15,11 @@ namespace Js
         static void DumpConstantTable(FunctionBody *dumpFunction);
         static void DumpOp(OpCode op, LayoutSize layoutSize, ByteCodeReader& reader, FunctionBody * dumpFunction);
 
+        // Opcode pair statistics (-BytecodePairHist): how often each executed opcode is followed by each other one
+        static const uint OpPairCount = (uint)OpCode::ByteCodeLast * (uint)OpCode::ByteCodeLast;
+        static uint GetOpPairIndex(OpCode op, OpCode nextOp) { return (uint)op * (uint)OpCode::ByteCodeLast + (uint)nextOp; }
+        static void DumpOpPairHistogram(uint const * pairHistogram);
+
     protected:
         static void DumpImplicitArgIns(FunctionBody * dumpFunction);
         static void DumpI4(int value);
@@ -4253,27 +4253,32 @@ class ByteCodeBufferReader
 };
 
 // Construct the byte code cache. Copy things needed by inline 'Lookup' functions from reader.
+// PropertyIds are registered lazily as functions referring to them are deserialized, so that
+// loading a large script doesn't touch its whole string table up front.
+// Library byte code is a static buffer deserialized by every script context, so its table is
+// owned by the thread context and filled in once for all of them.
 ByteCodeCache::ByteCodeCache(ScriptContext * scriptContext, ByteCodeBufferReader * reader, int builtInPropertyCount)
-    : reader(reader), propertyCount(reader->string16Count), builtInPropertyCount(builtInPropertyCount)
+    : reader(reader), scriptContext(scriptContext), propertyCount(reader->string16Count), builtInPropertyCount(builtInPropertyCount)
 {
-    auto alloc = scriptContext->SourceCodeAllocator();
-    propertyIds = AnewArray(alloc, PropertyId, propertyCount);
-    for (auto i=0; i < propertyCount; ++i)
+    if (reader->isLibraryCode)
     {
-        propertyIds[i] = -1;
+        propertyIds = scriptContext->GetThreadContext()->GetLibraryByteCodePropertyIds(reader->raw, propertyCount);
     }
-
-    raw = reader->raw;
-
-    // Read and populate PropertyIds
-    for(int i=0; i < propertyCount; ++i)
+    else
     {
-        PopulateLookupPropertyId(scriptContext, i);
+        auto alloc = scriptContext->SourceCodeAllocator();
+        propertyIds = AnewArray(alloc, PropertyId, propertyCount);
+        for (auto i=0; i < propertyCount; ++i)
+        {
+            propertyIds[i] = -1;
+        }
     }
+
+    raw = reader->raw;
 }
 
 // Deserialize and save a PropertyId
-void ByteCodeCache::PopulateLookupPropertyId(ScriptContext * scriptContext, int realOffset)
+void ByteCodeCache::PopulateLookupPropertyId(int realOffset)
 {
     PropertyId idInCache = realOffset + this->builtInPropertyCount;
     bool isPropertyRecord;
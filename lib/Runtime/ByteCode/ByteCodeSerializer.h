@@ -107,13 +107,26 @@ namespace Js
     class ByteCodeCache
     {
         ByteCodeBufferReader * reader;
+        ScriptContext * scriptContext;
         const byte * raw;
-        PropertyId * propertyIds;
+        PropertyId * propertyIds;       // Populated on first lookup; -1 until then
         int propertyCount;
         int builtInPropertyCount;
+
+        void PopulateLookupPropertyId(int realArrayOffset);
+
+        inline PropertyId GetPropertyIdAt(int realOffset)
+        {
+            Assert(realOffset<propertyCount);
+            if (propertyIds[realOffset] == -1)
+            {
+                PopulateLookupPropertyId(realOffset);
+            }
+            Assert(propertyIds[realOffset]!=-1);
+            return propertyIds[realOffset];
+        }
     public:
         ByteCodeCache(ScriptContext * scriptContext, ByteCodeBufferReader * reader, int builtInPropertyCount);
-        void PopulateLookupPropertyId(ScriptContext * scriptContext, int realArrayOffset);
 
         ByteCodeBufferReader* GetReader()
         {
@@ -121,26 +134,20 @@ namespace Js
         }
 
         // Convert a serialized propertyID into a real one.
-        inline PropertyId LookupPropertyId(PropertyId obscuredIdInCache) const
+        inline PropertyId LookupPropertyId(PropertyId obscuredIdInCache)
         {
             auto unobscured = obscuredIdInCache ^ SERIALIZER_OBSCURE_PROPERTY_ID;
             if (unobscured < builtInPropertyCount || unobscured==/*nil*/0xffffffff)
             {
                 return unobscured; // This is a built in property id
             }
-            auto realOffset = unobscured - builtInPropertyCount;
-            Assert(realOffset<propertyCount);
-            Assert(propertyIds[realOffset]!=-1);
-            return propertyIds[realOffset];
+            return GetPropertyIdAt(unobscured - builtInPropertyCount);
         }
 
         // Convert a serialized propertyID into a real one.
-        inline PropertyId LookupNonBuiltinPropertyId(PropertyId obscuredIdInCache) const
+        inline PropertyId LookupNonBuiltinPropertyId(PropertyId obscuredIdInCache)
         {
-            auto realOffset = obscuredIdInCache ^ SERIALIZER_OBSCURE_NONBUILTIN_PROPERTY_ID;
-            Assert(realOffset<propertyCount);
-            Assert(propertyIds[realOffset]!=-1);
-            return propertyIds[realOffset];
+            return GetPropertyIdAt(obscuredIdInCache ^ SERIALIZER_OBSCURE_NONBUILTIN_PROPERTY_ID);
         }
 
         // Get the raw byte code buffer.
@@ -302,6 +302,9 @@ MACRO_EXTEND_WMS( Nearest_Db                 , Double2         , None
 MACRO_EXTEND_WMS( Nearest_Flt                , Float2          , None            )
 MACRO_EXTEND_WMS( CurrentMemory_Int          , AsmReg1         , None            )
 MACRO_EXTEND_WMS( GrowMemory                 , Int2            , None            )
+MACRO_EXTEND_WMS( MemoryCopy                 , Int3            , None            )
+MACRO_EXTEND_WMS( MemoryFill                 , Int3            , None            )
+MACRO_EXTEND_WMS( TableCopy                  , Reg1Int3        , None            )
 MACRO_EXTEND    ( Unreachable_Void           , Empty           , OpNoFallThrough )
 MACRO_EXTEND_WMS( Conv_Check_DTI             , Int1Double1     , None            )
 MACRO_EXTEND_WMS( Conv_Check_FTI             , Int1Float1      , None            )
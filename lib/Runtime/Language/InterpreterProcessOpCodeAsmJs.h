@@ -158,6 +158,24 @@
     }
 #define PROCESS_I1toI1Mem(name, func) PROCESS_I1toI1Mem_COMMON(name, func,)
 
+#define PROCESS_I3toVMem_COMMON(name, func, suffix) \
+    case OpCodeAsmJs::name: \
+    { \
+        PROCESS_READ_LAYOUT_ASMJS(name, Int3, suffix); \
+        func(GetRegRawInt(playout->I0), GetRegRawInt(playout->I1), GetRegRawInt(playout->I2)); \
+        break; \
+    }
+#define PROCESS_I3toVMem(name, func) PROCESS_I3toVMem_COMMON(name, func,)
+
+#define PROCESS_R1I3toVMem_COMMON(name, func, suffix) \
+    case OpCodeAsmJs::name: \
+    { \
+        PROCESS_READ_LAYOUT_ASMJS(name, Reg1Int3, suffix); \
+        func(GetRegRawPtr(playout->R0), GetRegRawInt(playout->I1), GetRegRawInt(playout->I2), GetRegRawInt(playout->I3)); \
+        break; \
+    }
+#define PROCESS_R1I3toVMem(name, func) PROCESS_R1I3toVMem_COMMON(name, func,)
+
 #define PROCESS_L1toL1Mem_COMMON(name, func, suffix) \
     case OpCodeAsmJs::name: \
     { \
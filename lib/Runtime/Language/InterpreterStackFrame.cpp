@@ -7,6 +7,7 @@
 #include "RuntimeMathPch.h"
 #include "EHBailoutData.h"
 #include "Library/JavascriptRegularExpression.h"
+#include "ByteCode/ByteCodeDumper.h"
 #if DBG_DUMP
 #include "ByteCode/OpCodeUtilAsmJs.h"
 #endif
@@ -38,10 +39,18 @@
 /// direct local-function jump.
 ///----------------------------------------------------------------------------
 
+// Every handler starts with PROCESS_CASE and ends with PROCESS_NEXT_OP. By default that is an
+// ordinary switch case; the main interpreter loop redefines both for threaded dispatch (see
+// INTERPRETER_THREADED_DISPATCH in InterpreterLoop.inl).
+#define PROCESS_CASE(name) \
+    case OpCode::name: PROCESS_THREADED_LABEL(name)
+#define PROCESS_THREADED_LABEL(name)
+#define PROCESS_NEXT_OP() break
+
 #define PROCESS_FALLTHROUGH(name, func) \
-    case OpCode::name:
+    PROCESS_CASE(name)
 #define PROCESS_FALLTHROUGH_COMMON(name, func, suffix) \
-    case OpCode::name:
+    PROCESS_CASE(name)
 
 #define PROCESS_READ_LAYOUT(name, layout, suffix) \
     CompileAssert(OpCodeInfo<OpCode::name>::Layout == OpLayoutType::layout); \
@@ -50,30 +59,30 @@
 
 
 #define PROCESS_NOP_COMMON(name, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_NOP(name, layout) PROCESS_NOP_COMMON(name, layout,)
 
 #define PROCESS_CUSTOM_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_CUSTOM(name, func, layout) PROCESS_CUSTOM_COMMON(name, func, layout,)
 
 #define PROCESS_CUSTOM_L_COMMON(name, func, layout, regslot, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_CUSTOM_L(name, func, layout, regslot) PROCESS_CUSTOM_L_COMMON(name, func, layout, regslot,)
@@ -92,38 +101,38 @@
 #define PROCESS_CUSTOM_L_Value(name, func, layout) PROCESS_CUSTOM_L_COMMON(name, func, layout, Value,)
 
 #define PROCESS_TRY(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Br,); \
         func(playout); \
         ip = m_reader.GetIP(); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_EMPTY(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Empty, ); \
         func(); \
         ip = m_reader.GetIP(); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_TRYBR2_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg2, suffix); \
         func((const byte*)(playout + 1), playout->RelativeJumpOffset, playout->R1, playout->R2); \
         ip = m_reader.GetIP(); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_CALL_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         func(playout); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_CALL(name, func, layout) PROCESS_CALL_COMMON(name, func, layout,)
@@ -134,469 +143,469 @@
 
 
 #define PROCESS_A1toXX_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetRegAllowStackVar(playout->R0)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetReg(playout->R0)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toXX(name, func) PROCESS_A1toXX_COMMON(name, func,)
 
 #define PROCESS_A1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func(GetReg(playout->R0), GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toXXMem(name, func) PROCESS_A1toXXMem_COMMON(name, func,)
 
 #define PROCESS_A1toXXMemNonVar_COMMON(name, func, type, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         func((type)GetNonVarReg(playout->R0), GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toXXMemNonVar(name, func, type) PROCESS_A1toXXMemNonVar_COMMON(name, func, type,)
 
 #define PROCESS_XXtoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetReg(playout->R0, \
                 func()); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_XXtoA1(name, func) PROCESS_XXtoA1_COMMON(name, func,)
 
 #define PROCESS_XXtoA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetNonVarReg(playout->R0, \
                 func()); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_XXtoA1NonVar(name, func) PROCESS_XXtoA1NonVar_COMMON(name, func,)
 
 #define PROCESS_XXtoA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1, suffix); \
         SetReg(playout->R0, \
                 func(GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_XXtoA1Mem(name, func) PROCESS_XXtoA1Mem_COMMON(name, func,)
 
 #define PROCESS_A1toA1_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetRegAllowStackVar(playout->R0, \
                 func(GetRegAllowStackVar(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toA1_ALLOW_STACK(name, func) PROCESS_A1toA1_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_A1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toA1(name, func) PROCESS_A1toA1_COMMON(name, func,)
 
 
 #define PROCESS_A1toA1Profiled_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg2, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), playout->profileId)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toA1Profiled(name, func) PROCESS_A1toA1Profiled_COMMON(name, func,)
 
 #define PROCESS_A1toA1CallNoArg_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetReg(playout->R0, \
                 func(playout)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toA1CallNoArg(name, func, layout) PROCESS_A1toA1CallNoArg_COMMON(name, func, layout,)
 
 #define PROCESS_A1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toA1Mem(name, func) PROCESS_A1toA1Mem_COMMON(name, func,)
 
 #define PROCESS_A1toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toA1NonVar(name, func) PROCESS_A1toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_A1toA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1toA1MemNonVar(name, func) PROCESS_A1toA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_INNERtoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, InnerScopeFromIndex(playout->C1)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_INNERtoA1(name, fun) PROCESS_INNERtoA1_COMMON(name, func,)
 
 #define PROCESS_U1toINNERMemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Unsigned1, suffix); \
         SetInnerScopeFromIndex(playout->C1, func(GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_U1toINNERMemNonVar(name, func) PROCESS_U1toINNERMemNonVar_COMMON(name, func,)
 
 #define PROCESS_XXINNERtoA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(InnerScopeFromIndex(playout->C1), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_XXINNERtoA1MemNonVar(name, func) PROCESS_XXINNERtoA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_A1INNERtoA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(InnerScopeFromIndex(playout->C1), GetNonVarReg(playout->R1), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1LOCALtoA1MemNonVar(name, func) PROCESS_A1LOCALtoA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_LOCALI1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
                 func(this->localClosure, playout->C1)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_LOCALI1toA1(name, func) PROCESS_LOCALI1toA1_COMMON(name, func,)
 
 #define PROCESS_A1I1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), playout->C1)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1I1toA1(name, func) PROCESS_A1I1toA1_COMMON(name, func,)
 
 #define PROCESS_A1I1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2Int1, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), playout->C1, GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1I1toA1Mem(name, func) PROCESS_A1I1toA1Mem_COMMON(name, func,)
 
 #define PROCESS_RegextoA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
                 func(this->m_functionBody->GetLiteralRegex(playout->C1), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_RegextoA1(name, func) PROCESS_RegextoA1_COMMON(name, func,)
 
 #define PROCESS_A2toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2toXX(name, func) PROCESS_A2toXX_COMMON(name, func,)
 
 #define PROCESS_A2toXXMemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         func(GetNonVarReg(playout->R0), GetNonVarReg(playout->R1), GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2toXXMemNonVar(name, func) PROCESS_A2toXXMemNonVar_COMMON(name, func,)
 
 #define PROCESS_A1NonVarToA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2, suffix); \
         SetReg(playout->R0, \
             func(GetNonVarReg(playout->R1))); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 
 #define PROCESS_A2NonVarToA1Reg_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
             func(GetNonVarReg(playout->R1), playout->R2)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), GetReg(playout->R2),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2toA1Mem(name, func) PROCESS_A2toA1Mem_COMMON(name, func,)
 
 #define PROCESS_A2toA1MemProfiled_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg3, suffix); \
         SetReg(playout->R0, \
         func(GetReg(playout->R1), GetReg(playout->R2),GetScriptContext(), playout->profileId)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2toA1MemProfiled(name, func) PROCESS_A2toA1MemProfiled_COMMON(name, func,)
 
 #define PROCESS_A2toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1), GetNonVarReg(playout->R2))); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2toA1NonVar(name, func) PROCESS_A2toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_A2toA1MemNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetNonVarReg(playout->R0, \
                 func(GetNonVarReg(playout->R1), GetNonVarReg(playout->R2),GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2toA1MemNonVar(name, func) PROCESS_A2toA1MemNonVar_COMMON(name, func,)
 
 #define PROCESS_CMMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         SetReg(playout->R0, \
             func(GetReg(playout->R1), GetReg(playout->R2), GetScriptContext()) ? JavascriptBoolean::OP_LdTrue(GetScriptContext()) : \
                     JavascriptBoolean::OP_LdFalse(GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_CMMem(name, func) PROCESS_CMMem_COMMON(name, func,)
 
 #define PROCESS_ELEM_RtU_to_XX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementRootU, suffix); \
         func(playout->PropertyIdIndex); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_ELEM_RtU_to_XX(name, func) PROCESS_ELEM_RtU_to_XX_COMMON(name, func,)
 
 #define PROCESS_ELEM_C2_to_XX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementScopedC, suffix); \
         func(GetEnvForEvalCode(), playout->PropertyIdIndex, GetReg(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_ELEM_C2_to_XX(name, func) PROCESS_ELEM_C2_to_XX_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_SLOT_FB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlot, suffix); \
         SetReg(playout->Value, \
                 func((FrameDisplay*)GetNonVarReg(playout->Instance), this->m_functionBody->GetNestedFuncReference(playout->SlotIndex))); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_SLOT_FB(name, func) PROCESS_GET_ELEM_SLOT_FB_COMMON(name, func,)
 
 #define PROCESS_GET_SLOT_FB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         SetReg(playout->Value, \
                func(this->GetFrameDisplayForNestedFunc(), this->m_functionBody->GetNestedFuncReference(playout->SlotIndex))); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_SLOT_FB(name, func) PROCESS_GET_SLOT_FB_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_IMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementI, suffix); \
         SetReg(playout->Value, \
                 func(GetReg(playout->Instance), GetReg(playout->Element), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_IMem(name, func) PROCESS_GET_ELEM_IMem_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_IMem_Strict_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementI, suffix); \
         SetReg(playout->Value, \
                 func(GetReg(playout->Instance), GetReg(playout->Element), GetScriptContext(), PropertyOperation_StrictMode)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_IMem_Strict(name, func) PROCESS_GET_ELEM_IMem_Strict_COMMON(name, func,)
 
 #define PROCESS_BR(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Br,); \
         ip = func(playout); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #ifdef BYTECODE_BRANCH_ISLAND
 #define PROCESS_BRLONG(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrLong,); \
         ip = func(playout); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 #endif
 
 #define PROCESS_BRS(name,func)  \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrS,); \
         if (func(playout->val,GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRB_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetReg(playout->R1))) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRB(name, func) PROCESS_BRB_COMMON(name, func,)
 
 #define PROCESS_BRB_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetRegAllowStackVar(playout->R1))) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRB_ALLOW_STACK(name, func) PROCESS_BRB_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_BRBS_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetReg(playout->R1), GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRBS(name, func) PROCESS_BRBS_COMMON(name, func,)
 
 #define PROCESS_BRBReturnP1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1Unsigned1, suffix); \
         SetReg(playout->R1, func(GetForInEnumerator(playout->C2))); \
@@ -604,296 +613,296 @@
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRBReturnP1toA1(name, func) PROCESS_BRBReturnP1toA1_COMMON(name, func,)
 
 #define PROCESS_BRBMem_ALLOW_STACK_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg1, suffix); \
         if (func(GetRegAllowStackVar(playout->R1),GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 #define PROCESS_BRBMem_ALLOW_STACK(name, func) PROCESS_BRBMem_ALLOW_STACK_COMMON(name, func,)
 
 #define PROCESS_BRCMem_COMMON(name, func,suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrReg2, suffix); \
         if (func(GetReg(playout->R1), GetReg(playout->R2),GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRCMem(name, func) PROCESS_BRCMem_COMMON(name, func,)
 
 #define PROCESS_BRPROP(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrProperty,); \
         if (func(GetReg(playout->Instance), playout->PropertyIdIndex, GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRLOCALPROP(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrLocalProperty,); \
         if (func(this->localClosure, playout->PropertyIdIndex, GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_BRENVPROP(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, BrEnvProperty,); \
         if (func(LdEnv(), playout->SlotIndex, playout->PropertyIdIndex, GetScriptContext())) \
         { \
             ip = m_reader.SetCurrentRelativeOffset(ip, playout->RelativeJumpOffset); \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_W1(name, func) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, W1,); \
         func(playout->C1, GetScriptContext()); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_U1toA1_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetReg(playout->R0, \
                 func(playout->C1,GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 #define PROCESS_U1toA1(name, func) PROCESS_U1toA1_COMMON(name, func,)
 
 #define PROCESS_U1toA1NonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(playout->C1)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 #define PROCESS_U1toA1NonVar(name, func) PROCESS_U1toA1NonVar_COMMON(name, func,)
 
 #define PROCESS_U1toA1NonVar_FuncBody_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         SetNonVarReg(playout->R0, \
                 func(playout->C1,GetScriptContext(), this->m_functionBody)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 #define PROCESS_U1toA1NonVar_FuncBody(name, func) PROCESS_U1toA1NonVar_FuncBody_COMMON(name, func,)
 
 #define PROCESS_A1I2toXXNonVar_FuncBody(name, func) PROCESS_A1I2toXXNonVar_FuncBody_COMMON(name, func,)
 
 #define PROCESS_A1I2toXXNonVar_FuncBody_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3, suffix); \
         func(playout->R0, playout->R1, playout->R2, GetScriptContext(), this->m_functionBody); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1U1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg1Unsigned1, suffix); \
         func(GetReg(playout->R0), playout->C1); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1U1toXX(name, func) PROCESS_A1U1toXX_COMMON(name, func,)
 
 #define PROCESS_A1U1toXXWithCache_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ProfiledReg1Unsigned1, suffix); \
         func(GetReg(playout->R0), playout->C1, playout->profileId); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A1U1toXXWithCache(name, func) PROCESS_A1U1toXXWithCache_COMMON(name, func,)
 
 #define PROCESS_EnvU1toXX_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Unsigned1, suffix); \
         func(LdEnv(), playout->C1); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_EnvU1toXX(name, func) PROCESS_EnvU1toXX_COMMON(name, func,)
 
 #define PROCESS_GET_ELEM_SLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(GetNonVarReg(playout->Instance), playout)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_SLOTNonVar(name, func, layout) PROCESS_GET_ELEM_SLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_LOCALSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func((Var*)GetLocalClosure(), playout)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_LOCALSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_LOCALSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_PARAMSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func((Var*)GetParamClosure(), playout)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_PARAMSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_PARAMSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_INNERSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(InnerScopeFromIndex(playout->SlotIndex1), playout)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_INNERSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_INNERSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_GET_ELEM_ENVSLOTNonVar_COMMON(name, func, layout, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, layout, suffix); \
         SetNonVarReg(playout->Value, func(LdEnv(), playout)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_GET_ELEM_ENVSLOTNonVar(name, func, layout) PROCESS_GET_ELEM_ENVSLOTNonVar_COMMON(name, func, layout,)
 
 #define PROCESS_SET_ELEM_SLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlot, suffix); \
         func(GetNonVarReg(playout->Instance), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_SET_ELEM_SLOTNonVar(name, func) PROCESS_SET_ELEM_SLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_LOCALSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         func((Var*)GetLocalClosure(), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_SET_ELEM_LOCALSLOTNonVar(name, func) PROCESS_SET_ELEM_LOCALSLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_PARAMSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI1, suffix); \
         func((Var*)GetParamClosure(), playout->SlotIndex, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_SET_ELEM_PARAMSLOTNonVar(name, func) PROCESS_SET_ELEM_PARAMSLOTNonVar_COMMON(name, func,); \
 
 #define PROCESS_SET_ELEM_INNERSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI2, suffix); \
         func(InnerScopeFromIndex(playout->SlotIndex1), playout->SlotIndex2, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_SET_ELEM_INNERSLOTNonVar(name, func) PROCESS_SET_ELEM_INNERSLOTNonVar_COMMON(name, func,)
 
 #define PROCESS_SET_ELEM_ENVSLOTNonVar_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, ElementSlotI2, suffix); \
         func(LdEnv(), playout->SlotIndex1, playout->SlotIndex2, GetRegAllowStackVarEnableOnly(playout->Value)); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_SET_ELEM_ENVSLOTNonVar(name, func) PROCESS_SET_ELEM_ENVSLOTNonVar_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A3toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg4, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), GetReg(playout->R2), GetReg(playout->R3), GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A3toA1Mem(name, func) PROCESS_A3toA1Mem_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A2I1toA1Mem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3B1, suffix); \
         SetReg(playout->R0, \
                 func(GetReg(playout->R1), GetReg(playout->R2), playout->B3, GetScriptContext())); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2I1toA1Mem(name, func) PROCESS_A2I1toA1Mem_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A2I1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg2B1, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1), playout->B2, scriptContext); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A2I1toXXMem(name, func) PROCESS_A2I1toXXMem_COMMON(name, func,)
 
 /*---------------------------------------------------------------------------------------------- */
 #define PROCESS_A3I1toXXMem_COMMON(name, func, suffix) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         PROCESS_READ_LAYOUT(name, Reg3B1, suffix); \
         func(GetReg(playout->R0), GetReg(playout->R1), GetReg(playout->R2), playout->B3, scriptContext); \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 
 #define PROCESS_A3I1toXXMem(name, func) PROCESS_A3I1toXXMem_COMMON(name, func,)
 
 #if ENABLE_PROFILE_INFO
 #define PROCESS_IP_TARG_IMPL(name, func, layoutSize) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         Assert(!switchProfileMode); \
         ip = func<layoutSize, INTERPRETERPROFILE>(ip); \
@@ -902,14 +911,14 @@
             m_reader.SetIP(ip); \
             return nullptr; \
         } \
-        break; \
+        PROCESS_NEXT_OP(); \
     }
 #else
 #define PROCESS_IP_TARG_IMPL(name, func, layoutSize) \
-    case OpCode::name: \
+    PROCESS_CASE(name) \
     { \
         ip = func<layoutSize, INTERPRETERPROFILE>(ip); \
-       break; \
+        PROCESS_NEXT_OP(); \
     }
 #endif
 
@@ -1149,6 +1158,9 @@ namespace Js
         newInstance->nestedCatchDepth = -1;
         newInstance->nestedFinallyDepth = -1;
         newInstance->retOffset = 0;
+#if DBG_DUMP
+        newInstance->DEBUG_previousOp = OpCode::ByteCodeLast;
+#endif
         newInstance->localFrameDisplay = nullptr;
         newInstance->localClosure = nullptr;
         newInstance->paramClosure = nullptr;
@@ -2451,6 +2463,14 @@ namespace Js
     {
 #if DBG_DUMP
         that->scriptContext->byteCodeHistogram[(int)op]++;
+        if (that->scriptContext->byteCodePairHistogram != nullptr && !OpCodeUtil::IsPrefixOpcode(op))
+        {
+            if (that->DEBUG_previousOp != OpCode::ByteCodeLast)
+            {
+                that->scriptContext->byteCodePairHistogram[ByteCodeDumper::GetOpPairIndex(that->DEBUG_previousOp, op)]++;
+            }
+            that->DEBUG_previousOp = op;
+        }
         if (PHASE_TRACE(Js::InterpreterPhase, that->m_functionBody))
         {
             Output::Print(_u("%d.%d:Executing %s at offset 0x%X\n"), that->m_functionBody->GetSourceContextId(), that->m_functionBody->GetLocalFunctionId(), Js::OpCodeUtil::GetOpCodeName(op), that->DEBUG_currentByteOffset);
@@ -6016,7 +6036,7 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(uint loopId)
         loopHeader->interpretCount += !isFirstIteration;
 
         const uint loopInterpretCount = GetFunctionBody()->GetLoopInterpretCount(loopHeader);
-        if (loopHeader->interpretCount > loopInterpretCount)
+        if (loopHeader->interpretCount > loopInterpretCount || this->DoJITLoopBodyAfterFullJit())
         {
             if (this->scriptContext->GetConfig()->IsNoNative())
             {
@@ -6068,6 +6088,21 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(uint loopId)
         return nullptr;
     }
 
+    bool
+    InterpreterStackFrame::DoJITLoopBodyAfterFullJit()
+    {
+        // A call that entered the interpreter before its function was sent to full JIT (the outermost call of a recursive
+        // chain, or a long-running top-level call) would otherwise keep interpreting each loop until it got hot again.
+        // The function's profile was already good enough for full JIT, so move this frame into jitted code at the next
+        // loop header instead. Frames that bailed out of jitted code keep interpreting, so that they don't go straight back
+        // into code that just bailed out.
+        return
+            m_functionBody->GetExecutionMode() == ExecutionMode::FullJit &&
+            !m_functionBody->GetIsAsmJsFunction() &&
+            !this->TestFlags(InterpreterStackFrameFlags_FromBailOut) &&
+            !PHASE_OFF(Js::JITLoopBodyAfterFullJitPhase, m_functionBody);
+    }
+
     void
     InterpreterStackFrame::CheckIfLoopIsHot(uint profiledLoopCounter)
     {
@@ -7902,6 +7937,33 @@ const byte * InterpreterStackFrame::OP_ProfiledLoopBodyStart(uint loopId)
 #endif
     }
 
+    void InterpreterStackFrame::OP_MemoryCopy(int32 dst, int32 src, int32 count)
+    {
+#ifdef ENABLE_WASM
+        WebAssemblyMemory::CopyHelper(GetWebAssemblyMemory(), (uint32)dst, (uint32)src, (uint32)count);
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
+    void InterpreterStackFrame::OP_MemoryFill(int32 dst, int32 value, int32 count)
+    {
+#ifdef ENABLE_WASM
+        WebAssemblyMemory::FillHelper(GetWebAssemblyMemory(), (uint32)dst, value, (uint32)count);
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
+    void InterpreterStackFrame::OP_TableCopy(Var table, int32 dst, int32 src, int32 count)
+    {
+#ifdef ENABLE_WASM
+        WebAssemblyTable::CopyHelper(WebAssemblyTable::FromVar(table), (uint32)dst, (uint32)src, (uint32)count);
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
     template <typename T, InterpreterStackFrame::AsmJsMathPtr<T> func> T InterpreterStackFrame::OP_UnsignedDivRemCheck(T aLeft, T aRight, ScriptContext* scriptContext)
     {
         if (aRight == 0)
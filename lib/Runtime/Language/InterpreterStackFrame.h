@@ -158,6 +158,9 @@ namespace Js
 #if DBG || DBG_DUMP
         void * DEBUG_currentByteOffset;
 #endif
+#if DBG_DUMP
+        Js::OpCode DEBUG_previousOp;        // For -BytecodePairHist
+#endif
 #if DBG
         Var* m_outParamsEnd;
 #endif
@@ -232,6 +235,9 @@ namespace Js
         void ValidateRegValue(Var value, bool allowStackVar = false, bool allowStackVarOnDisabledStackNestedFunc = true) const;
         int OP_GetMemorySize();
         int32 OP_GrowMemory(int32 delta);
+        void OP_MemoryCopy(int32 dst, int32 src, int32 count);
+        void OP_MemoryFill(int32 dst, int32 value, int32 count);
+        void OP_TableCopy(Var table, int32 dst, int32 src, int32 count);
         void OP_Unreachable();
         template <typename T> using AsmJsMathPtr = T(*)(T a, T b);
         template <typename T, AsmJsMathPtr<T> func> static T OP_DivOverflow(T a, T b, ScriptContext* scriptContext);
@@ -729,6 +735,7 @@ namespace Js
         void OP_LdPropIds(const unaligned OpLayoutAuxiliary * playout);
         template <bool Profile, bool JITLoopBody> void LoopBodyStart(uint32 loopNumber, LayoutSize layoutSize, bool isFirstIteration);
         LoopHeader const * DoLoopBodyStart(uint32 loopNumber, LayoutSize layoutSize, const bool doProfileLoopCheck, bool isFirstIteration);
+        bool DoJITLoopBodyAfterFullJit();
         template <bool Profile, bool JITLoopBody> void ProfiledLoopBodyStart(uint32 loopNumber, LayoutSize layoutSize, bool isFirstIteration);
         void OP_RecordImplicitCall(uint loopNumber);
         template <class T, bool Profiled, bool ICIndex> void OP_NewScObject_Impl(const unaligned T* playout, InlineCacheIndex inlineCacheIndex = Js::Constants::NoInlineCacheIndex, const Js::AuxArray<uint32> *spreadIndices = nullptr);
@@ -0,0 +1,295 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+DWORD const PersistentProfileCache::MagicNumber = 0x4350534A;         // 'JSPC'
+DWORD const PersistentProfileCache::ExtentMagicNumber = 0x5846534A;   // 'JSFX'
+DWORD const PersistentProfileCache::FileFormatVersion = 2;
+#ifdef DEBUG
+DWORD const PersistentProfileCache::BuildFlavor = 1;
+#else
+DWORD const PersistentProfileCache::BuildFlavor = 0;
+#endif
+
+//
+// Read-only view of a profile file, unmapped and closed on destruction
+//
+class PersistentProfileCache::FileView
+{
+public:
+    FileView() : file(INVALID_HANDLE_VALUE), mapping(nullptr), view(nullptr), size(0) {}
+    ~FileView()
+    {
+        if (view != nullptr)
+        {
+            UnmapViewOfFile(view);
+        }
+        if (mapping != nullptr)
+        {
+            CloseHandle(mapping);
+        }
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+    }
+
+    bool Open(char16 const * filename)
+    {
+        file = CreateFileW(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        DWORD sizeHigh;
+        DWORD sizeLow = GetFileSize(file, &sizeHigh);
+        if (sizeLow == INVALID_FILE_SIZE || sizeHigh != 0 || sizeLow == 0)
+        {
+            return false;
+        }
+
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        view = (byte const *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        size = sizeLow;
+        return view != nullptr;
+    }
+
+    byte const * GetView() const { return view; }
+    size_t GetSize() const { return size; }
+
+private:
+    HANDLE file;
+    HANDLE mapping;
+    byte const * view;
+    size_t size;
+};
+
+uint64
+PersistentProfileCache::ComputeHash(__in_bcount(byteCount) byte const * data, size_t byteCount)
+{
+    // 64-bit FNV-1a
+    uint64 hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < byteCount; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ull;
+    }
+
+    // Zero is reserved to mean "no source hash"
+    return hash != 0 ? hash : 1;
+}
+
+bool
+PersistentProfileCache::InitializeHeader(DWORD magic, uint64 sourceHash, uint32 count, uint32 unitSize, uint64 dataHash, __out FileHeader * header)
+{
+    memset(header, 0, sizeof(FileHeader));
+    if (FAILED(AutoSystemInfo::GetJscriptFileVersion(&header->engineMajorVersion, &header->engineMinorVersion,
+        &header->buildDateHash, &header->buildTimeHash)))
+    {
+        return false;
+    }
+
+    header->magic = magic;
+    header->version = FileFormatVersion;
+    header->buildFlavor = BuildFlavor;
+    header->sourceHash = sourceHash;
+    header->dataHash = dataHash;
+    header->functionCount = count;
+    header->unitSize = unitSize;
+    return true;
+}
+
+bool
+PersistentProfileCache::GetFilename(uint64 sourceHash, char16 const * extension, _Out_writes_z_(_MAX_PATH) char16 filename[_MAX_PATH])
+{
+    char16 const * dirname = Js::Configuration::Global.flags.PersistentProfileCacheDir;
+    Assert(dirname != nullptr);
+    return swprintf_s(filename, _MAX_PATH, _u("%s/%08x%08x.%s"), dirname,
+        (uint32)(sourceHash >> 32), (uint32)sourceHash, extension) > 0;
+}
+
+PersistentProfileCache::FileHeader const *
+PersistentProfileCache::OpenFile(uint64 sourceHash, DWORD magic, char16 const * extension, uint32 unitSize,
+    _Out_writes_z_(_MAX_PATH) char16 filename[_MAX_PATH], FileView * fileView)
+{
+    if (!GetFilename(sourceHash, extension, filename))
+    {
+        return nullptr;
+    }
+
+    if (!fileView->Open(filename))
+    {
+        OUTPUT_VERBOSE_TRACE(Js::DynamicProfilePhase, _u("Persistent profile not found: %s\n"), filename);
+        return nullptr;
+    }
+
+    FileHeader expectedHeader;
+    FileHeader const * header = (FileHeader const *)fileView->GetView();
+    if (fileView->GetSize() < sizeof(FileHeader)
+        || !InitializeHeader(magic, sourceHash, header->functionCount, unitSize, header->dataHash, &expectedHeader)
+        || memcmp(header, &expectedHeader, sizeof(FileHeader)) != 0
+        || header->functionCount == 0
+        || header->functionCount > MaxFunctionCount
+        || ComputeHash((byte const *)(header + 1), fileView->GetSize() - sizeof(FileHeader)) != header->dataHash)
+    {
+        // Stale (different engine build or source) or corrupt; it will be overwritten on the next save
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Persistent profile rejected: %s\n"), filename);
+        return nullptr;
+    }
+
+    return header;
+}
+
+uint
+PersistentProfileCache::WriteFile(FileHeader const * header, char16 const * extension, __in_bcount(byteCount) void const * data, size_t byteCount)
+{
+    char16 filename[_MAX_PATH];
+    char16 tempFilename[_MAX_PATH];
+    if (!GetFilename(header->sourceHash, extension, filename)
+        || swprintf_s(tempFilename, _MAX_PATH, _u("%s.%u"), filename, GetCurrentProcessId()) <= 0)
+    {
+        return 0;
+    }
+
+    FILE * file;
+    if (_wfopen_s(&file, tempFilename, _u("wb")) != 0)
+    {
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Unable to create persistent profile: %s\n"), tempFilename);
+        return 0;
+    }
+
+    byte const * bytes = (byte const *)data;
+    size_t bytesLeft = byteCount;
+    bool written = fwrite(header, sizeof(FileHeader), 1, file) == 1;
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (CONFIG_FLAG(ForceCorruptPersistentProfileCache) && bytesLeft != 0)
+    {
+        // Flip the first byte after the header, as a torn write would, so the data no longer matches its hash
+        byte corruptByte = (byte)~bytes[0];
+        written = written && fwrite(&corruptByte, 1, 1, file) == 1;
+        bytes++;
+        bytesLeft--;
+    }
+#endif
+    written = written && fwrite(bytes, 1, bytesLeft, file) == bytesLeft;
+    written = (fclose(file) == 0) && written;
+
+    // Readers map the file, so replace it atomically rather than rewriting it in place
+    if (!written || !MoveFileExW(tempFilename, filename, MOVEFILE_REPLACE_EXISTING))
+    {
+        _wunlink(tempFilename);
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Unable to write persistent profile: %s\n"), filename);
+        return 0;
+    }
+
+    return (uint)(sizeof(FileHeader) + byteCount);
+}
+
+BVFixed *
+PersistentProfileCache::Load(uint64 sourceHash, Recycler * recycler)
+{
+    Assert(IsEnabled());
+
+    char16 filename[_MAX_PATH];
+    FileView fileView;
+    FileHeader const * header = OpenFile(sourceHash, MagicNumber, _u("jspc"), sizeof(BVUnit), filename, &fileView);
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+
+    BVIndex wordCount = BVFixed::WordCount(header->functionCount);
+    if (fileView.GetSize() != sizeof(FileHeader) + wordCount * sizeof(BVUnit))
+    {
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Persistent profile rejected: %s\n"), filename);
+        return nullptr;
+    }
+
+    OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Persistent profile load succeeded. Count: %d  %s\n"), header->functionCount, filename);
+    BVFixed * functions = BVFixed::New(header->functionCount, recycler);
+    js_memcpy_s(functions->GetData(), wordCount * sizeof(BVUnit), header + 1, wordCount * sizeof(BVUnit));
+    return functions;
+}
+
+uint
+PersistentProfileCache::Save(uint64 sourceHash, BVFixed const * startupFunctions)
+{
+    Assert(IsEnabled());
+    Assert(startupFunctions != nullptr);
+
+    size_t byteCount = startupFunctions->WordCount() * sizeof(BVUnit);
+    FileHeader header;
+    if (startupFunctions->Length() > MaxFunctionCount
+        || !InitializeHeader(MagicNumber, sourceHash, startupFunctions->Length(), sizeof(BVUnit),
+            ComputeHash((byte const *)startupFunctions->GetData(), byteCount), &header))
+    {
+        return 0;
+    }
+
+    return WriteFile(&header, _u("jspc"), startupFunctions->GetData(), byteCount);
+}
+
+DeferredFunctionExtent const *
+PersistentProfileCache::LoadDeferredFunctionExtents(uint64 sourceHash, Recycler * recycler, __out uint * count)
+{
+    Assert(IsEnabled());
+    *count = 0;
+
+    char16 filename[_MAX_PATH];
+    FileView fileView;
+    FileHeader const * header = OpenFile(sourceHash, ExtentMagicNumber, _u("jsfx"), sizeof(DeferredFunctionExtent), filename, &fileView);
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+
+    DeferredFunctionExtent const * fileExtents = (DeferredFunctionExtent const *)(header + 1);
+    bool isValid = fileView.GetSize() == sizeof(FileHeader) + header->functionCount * sizeof(DeferredFunctionExtent);
+    for (uint32 i = 1; isValid && i < header->functionCount; i++)
+    {
+        // The parser binary searches the extents
+        isValid = fileExtents[i - 1].ichMin < fileExtents[i].ichMin;
+    }
+
+    if (!isValid)
+    {
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Persistent profile rejected: %s\n"), filename);
+        return nullptr;
+    }
+
+    OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Persistent profile load succeeded. Count: %d  %s\n"), header->functionCount, filename);
+
+    DeferredFunctionExtent * extents = RecyclerNewArrayLeaf(recycler, DeferredFunctionExtent, header->functionCount);
+    js_memcpy_s(extents, header->functionCount * sizeof(DeferredFunctionExtent), fileExtents, header->functionCount * sizeof(DeferredFunctionExtent));
+    *count = header->functionCount;
+    return extents;
+}
+
+uint
+PersistentProfileCache::SaveDeferredFunctionExtents(uint64 sourceHash, __in_ecount(count) DeferredFunctionExtent const * extents, uint count)
+{
+    Assert(IsEnabled());
+    Assert(extents != nullptr);
+
+    size_t byteCount = count * sizeof(DeferredFunctionExtent);
+    FileHeader header;
+    if (count == 0
+        || count > MaxFunctionCount
+        || !InitializeHeader(ExtentMagicNumber, sourceHash, count, sizeof(DeferredFunctionExtent),
+            ComputeHash((byte const *)extents, byteCount), &header))
+    {
+        return 0;
+    }
+
+    return WriteFile(&header, _u("jsfx"), extents, byteCount);
+}
+#endif
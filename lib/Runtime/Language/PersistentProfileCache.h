@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+//
+// PersistentProfileCache saves the startup function bit vector of each script to a file under
+// -PersistentProfileCacheDir so that a new process running the same script can defer-parse and
+// speculatively JIT based on what the previous process executed, the same way the WININET cache
+// does for the browser.
+//
+// There is one file per script, named after a 64-bit hash of the script source. The file is a
+// fixed size header followed by the raw bit vector words, 8-byte aligned, so it is read through a
+// read-only file mapping without any parsing. The header identifies the engine build and holds a
+// hash of the data, so files from another build and truncated or corrupt files are ignored. Files are written to a temporary name and renamed into
+// place so concurrent processes never observe a partially written profile.
+//
+// A second file per script, with the same header, holds the extents of the function bodies that were
+// deferred when the script was last parsed, so the parser can seek past them instead of scanning them.
+//
+
+//
+// Where a deferred function body ends, and what scanning it found. This is a flattened RestorePoint
+// plus the function flags a DeferredFunctionStub records; see Parser::ParseTopLevelDeferredFunc.
+//
+struct DeferredFunctionExtent
+{
+    uint32 ichMin;                  // Start of the function; extents are sorted on this
+    uint32 fncFlags;
+    uint32 nestedCount;
+    uint32 functionIdIncrement;
+    uint32 ichMinTok;               // The closing brace of the body
+    uint32 ichMinLine;
+    uint32 line;
+    uint32 hadEol;
+    uint64 cMinTokMultiUnits;
+    uint64 cMinLineMultiUnits;
+    uint64 cMultiUnits;             // DEBUG only
+    uint64 lengthDecr;
+};
+CompileAssert(sizeof(DeferredFunctionExtent) % sizeof(uint64) == 0);
+
+class PersistentProfileCache
+{
+public:
+    static bool IsEnabled() { return Js::Configuration::Global.flags.PersistentProfileCacheDir != nullptr; }
+
+    static uint64 ComputeHash(__in_bcount(byteCount) byte const * data, size_t byteCount);
+    static BVFixed * Load(uint64 sourceHash, Recycler * recycler);
+    static uint Save(uint64 sourceHash, BVFixed const * startupFunctions);
+    static DeferredFunctionExtent const * LoadDeferredFunctionExtents(uint64 sourceHash, Recycler * recycler, __out uint * count);
+    static uint SaveDeferredFunctionExtents(uint64 sourceHash, __in_ecount(count) DeferredFunctionExtent const * extents, uint count);
+
+private:
+    struct FileHeader
+    {
+        DWORD magic;
+        DWORD version;
+        DWORD engineMajorVersion;
+        DWORD engineMinorVersion;
+        DWORD buildDateHash;
+        DWORD buildTimeHash;
+        DWORD buildFlavor;          // Debug builds persist extra scanner state, see DeferredFunctionExtent::cMultiUnits
+        DWORD reserved;
+        uint64 sourceHash;
+        uint64 dataHash;            // Hash of everything after the header
+        uint32 functionCount;
+        uint32 unitSize;
+    };
+    CompileAssert(sizeof(FileHeader) % sizeof(uint64) == 0);
+
+    class FileView;
+
+    static bool InitializeHeader(DWORD magic, uint64 sourceHash, uint32 count, uint32 unitSize, uint64 dataHash, __out FileHeader * header);
+    static bool GetFilename(uint64 sourceHash, char16 const * extension, _Out_writes_z_(_MAX_PATH) char16 filename[_MAX_PATH]);
+    static FileHeader const * OpenFile(uint64 sourceHash, DWORD magic, char16 const * extension, uint32 unitSize,
+        _Out_writes_z_(_MAX_PATH) char16 filename[_MAX_PATH], FileView * fileView);
+    static uint WriteFile(FileHeader const * header, char16 const * extension, __in_bcount(byteCount) void const * data, size_t byteCount);
+
+    static DWORD const MagicNumber;
+    static DWORD const ExtentMagicNumber;
+    static DWORD const FileFormatVersion;
+    static DWORD const BuildFlavor;
+    static uint const MaxFunctionCount = 1000000;   // Consider the file corrupt if there are more functions than this
+};
+#endif
@@ -25,6 +25,7 @@
 #ifdef DYNAMIC_PROFILE_STORAGE
 #include "Language/DynamicProfileStorage.h"
 #endif
+#include "Language/PersistentProfileCache.h"
 #include "Language/SourceDynamicProfileManager.h"
 
 #include "Base/EtwTrace.h"
@@ -165,12 +165,92 @@ namespace Js
         return false;
     }
 
+#if ENABLE_PERSISTENT_PROFILE_CACHE
     //
-    // Saves the profile to the WININET cache and returns the bytes written
+    // Loads the profile saved by a previous process for the same source from the persistent profile cache
+    //
+    bool SourceDynamicProfileManager::LoadFromPersistentProfileCache(__in_bcount(byteCount) byte const * source, size_t byteCount, LPCWSTR url)
+    {
+        Assert(PersistentProfileCache::IsEnabled());
+        AssertMsg(persistentProfileSourceHash == 0, "Duplicate persistent profile loading?");
+
+        this->persistentProfileSourceHash = PersistentProfileCache::ComputeHash(source, byteCount);
+        if (IsProfileLoaded())
+        {
+            return false;
+        }
+
+        BVFixed* functions = PersistentProfileCache::Load(this->persistentProfileSourceHash, this->recycler);
+        if (functions == nullptr)
+        {
+            return false;
+        }
+
+        this->cachedStartupFunctions = functions;
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Persistent profile loaded for %s\n"), url);
+        return true;
+    }
+
+    //
+    // Returns the deferred function extents cached for the source being parsed. A host may run different scripts
+    // under the same source context, so they are looked up by the hash of that source rather than the hash the
+    // profile was loaded under, and loaded again whenever the source changes.
+    //
+    DeferredFunctionExtent const * SourceDynamicProfileManager::GetCachedFunctionExtents(__in_bcount(byteCount) byte const * source, size_t byteCount, __out uint64 * sourceHash, __out uint * count)
+    {
+        Assert(persistentProfileSourceHash != 0);
+
+        uint64 hash = PersistentProfileCache::ComputeHash(source, byteCount);
+        if (hash != this->functionExtentsSourceHash)
+        {
+            this->functionExtentsSourceHash = hash;
+            this->cachedFunctionExtents = PersistentProfileCache::LoadDeferredFunctionExtents(hash, this->recycler, &this->cachedFunctionExtentCount);
+        }
+
+        *sourceHash = hash;
+        *count = this->cachedFunctionExtentCount;
+        return this->cachedFunctionExtents;
+    }
+
+    //
+    // Saves the deferred function extents the parser recorded, unless they were loaded from the cache in the first place
+    //
+    void SourceDynamicProfileManager::SaveDeferredFunctionExtents(uint64 sourceHash, __in_ecount(count) DeferredFunctionExtent const * extents, uint count)
+    {
+        if (persistentProfileSourceHash == 0 || count == 0
+            || (sourceHash == functionExtentsSourceHash && cachedFunctionExtents != nullptr))
+        {
+            return;
+        }
+
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Saving deferred function extents. Number of functions: %d\n"), count);
+        PersistentProfileCache::SaveDeferredFunctionExtents(sourceHash, extents, count);
+
+        // Load what was just saved the next time this source is parsed
+        functionExtentsSourceHash = 0;
+        cachedFunctionExtents = nullptr;
+        cachedFunctionExtentCount = 0;
+    }
+#endif
+
+    //
+    // Saves the profile to the WININET or persistent profile cache and returns the bytes written
     //
     uint SourceDynamicProfileManager::SaveToProfileCacheAndRelease(SourceContextInfo* info)
     {
         uint bytesWritten = 0;
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+        if(persistentProfileSourceHash != 0)
+        {
+            if(ShouldSaveToProfileCache(info))
+            {
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Saving persistent profile. Number of functions: %d Url: %s...\n"), startupFunctions->Length(), info->url);
+
+                bytesWritten = PersistentProfileCache::Save(persistentProfileSourceHash, startupFunctions);
+            }
+            persistentProfileSourceHash = 0;
+        }
+#endif
 #ifdef ENABLE_WININET_PROFILE_DATA_CACHE
         if(profileDataCache)
         {
@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 class SourceContextInfo;
+struct DeferredFunctionExtent;
 
 #if ENABLE_PROFILE_INFO
 namespace Js
@@ -16,7 +17,7 @@ namespace Js
     };
     //
     // For every source file, an instance of SourceDynamicProfileManager is used to save/load data.
-    // It uses the WININET cache to save/load profile data.
+    // It uses the WININET cache to save/load profile data, or the persistent profile cache directory outside of the browser.
     // For testing scenarios enabled using DYNAMIC_PROFILE_STORAGE macro, this can persist the profile info into a file as well.
     class SourceDynamicProfileManager
     {
@@ -25,7 +26,10 @@ namespace Js
 #ifdef DYNAMIC_PROFILE_STORAGE
             dynamicProfileInfoMapSaving(&HeapAllocator::Instance),
 #endif
-            dynamicProfileInfoMap(allocator), startupFunctions(nullptr), profileDataCache(nullptr) 
+            dynamicProfileInfoMap(allocator), startupFunctions(nullptr), profileDataCache(nullptr)
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+            , persistentProfileSourceHash(0), functionExtentsSourceHash(0), cachedFunctionExtents(nullptr), cachedFunctionExtentCount(0)
+#endif
         {
         }
 
@@ -43,6 +47,12 @@ namespace Js
         bool IsProfileLoadedFromWinInet() { return profileDataCache != nullptr; }
         bool LoadFromProfileCache(IActiveScriptDataCache* profileDataCache, LPCWSTR url);
         IActiveScriptDataCache* GetProfileCache() { return profileDataCache; }
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+        bool LoadFromPersistentProfileCache(__in_bcount(byteCount) byte const * source, size_t byteCount, LPCWSTR url);
+        uint64 GetPersistentProfileSourceHash() const { return persistentProfileSourceHash; }
+        DeferredFunctionExtent const * GetCachedFunctionExtents(__in_bcount(byteCount) byte const * source, size_t byteCount, __out uint64 * sourceHash, __out uint * count);
+        void SaveDeferredFunctionExtents(uint64 sourceHash, __in_ecount(count) DeferredFunctionExtent const * extents, uint count);
+#endif
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
 #ifdef DYNAMIC_PROFILE_STORAGE
         void ClearSavingData();
@@ -77,6 +87,12 @@ namespace Js
                                                             // It's not modified but used as an input for deferred parsing/bytecodegen
         typedef JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, Recycler, PowerOf2SizePolicy>  DynamicProfileInfoMapType;
         Field(DynamicProfileInfoMapType) dynamicProfileInfoMap;
+#if ENABLE_PERSISTENT_PROFILE_CACHE
+        Field(uint64) persistentProfileSourceHash;          // Hash of the source the profile is persisted under; 0 if not persisted
+        Field(uint64) functionExtentsSourceHash;            // Hash of the source cachedFunctionExtents were loaded for; 0 if none
+        Field(DeferredFunctionExtent const *) cachedFunctionExtents;    // Deferred function bodies the parser can skip; see Parser::ParseTopLevelDeferredFunc
+        Field(uint) cachedFunctionExtentCount;
+#endif
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
 
@@ -5,10 +5,56 @@
 #include "RuntimeLibraryPch.h"
 #include "JSONScanner.h"
 
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
 using namespace Js;
 
 namespace JSON
 {
+    // Returns the first character in [current, end) that needs attention inside a string literal:
+    // the closing quote, a backslash or a control character. Everything before it is copied as is.
+    static const char16* SkipPlainStringChars(const char16* current, const char16* end)
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        const __m128i quote = _mm_set1_epi16('"');
+        const __m128i backslash = _mm_set1_epi16('\\');
+        const __m128i lastControlChar = _mm_set1_epi16(0x1F);
+        const __m128i zero = _mm_setzero_si128();
+        while (end - current >= 8)
+        {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+
+            // Unsigned saturating subtraction leaves zero exactly for the control characters
+            __m128i special = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi16(chars, quote), _mm_cmpeq_epi16(chars, backslash)),
+                _mm_cmpeq_epi16(_mm_subs_epu16(chars, lastControlChar), zero));
+            int mask = _mm_movemask_epi8(special);
+            if (mask != 0)
+            {
+                DWORD index;
+                _BitScanForward(&index, mask);
+                return current + index / sizeof(char16);
+            }
+            current += 8;
+        }
+#endif
+
+        while (current < end)
+        {
+            char16 ch = *current;
+            if (ch == '"' || ch == '\\' || ch <= 0x1F)
+            {
+                break;
+            }
+            current++;
+        }
+        return current;
+    }
+
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
@@ -85,6 +131,24 @@ namespace JSON
                        ThrowSyntaxError(JSERR_JsonBadNumber);
                     }
                     currentChar = saveCurrentChar;
+
+                    // Integers of up to 15 digits are exact in a double and don't need the general conversion
+                    const char16* digitsEnd = currentChar;
+                    uint64 intValue = 0;
+                    while (digitsEnd < inputText + inputLen && *digitsEnd >= '0' && *digitsEnd <= '9' && digitsEnd - currentChar < 16)
+                    {
+                        intValue = intValue * 10 + (*digitsEnd - '0');
+                        digitsEnd++;
+                    }
+                    if (digitsEnd - currentChar < 16 &&
+                        (digitsEnd == inputText + inputLen || (*digitsEnd != '.' && *digitsEnd != 'e' && *digitsEnd != 'E')))
+                    {
+                        pToken->tk = tkFltCon;
+                        pToken->SetDouble((double)intValue, false);
+                        currentChar = digitsEnd;
+                        return tkFltCon;
+                    }
+
                     double val;
                     const char16* end = nullptr;
                     val = Js::NumberUtilities::StrToDbl(currentChar, &end, scriptContext);
@@ -233,6 +297,15 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            // Most characters are copied as is, skip over them in bulk
+            const char16* plainEnd = SkipPlainStringChars(currentChar, inputText + inputLen);
+            bulkLength += (uint)(plainEnd - currentChar);
+            currentChar = plainEnd;
+            if (currentChar >= inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
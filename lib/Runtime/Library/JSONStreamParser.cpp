@@ -0,0 +1,342 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+#include "Codex/Utf8Codex.h"
+#include "JSONParser.h"
+#include "JSONStreamParser.h"
+
+using namespace Js;
+
+namespace JSON
+{
+    JSONStreamParser::JSONStreamParser(Js::ScriptContext* scriptContext, Mode mode) :
+        scriptContext(scriptContext),
+        mode(mode),
+        pending(nullptr),
+        pendingLength(0),
+        pendingCapacity(0),
+        scanOffset(0),
+        decodeBuffer(nullptr),
+        decodeBufferLength(0),
+        valueStart(0),
+        depth(0),
+        arrayState(BeforeArray),
+        inValue(false),
+        inString(false),
+        inScalar(false),
+        escaped(false),
+        hasFailed(false),
+        isComplete(false),
+        values(&HeapAllocator::Instance),
+        nextValueIndex(0)
+    {
+    }
+
+    JSONStreamParser::~JSONStreamParser()
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        for (int i = nextValueIndex; i < values.Count(); i++)
+        {
+            Js::Var value = values.Item(i);
+            if (!TaggedNumber::Is(value))
+            {
+                recycler->RootRelease(value);
+            }
+        }
+
+        if (pending != nullptr)
+        {
+            HeapDeleteArray(pendingCapacity, pending);
+        }
+        if (decodeBuffer != nullptr)
+        {
+            HeapDeleteArray(decodeBufferLength, decodeBuffer);
+        }
+    }
+
+    void JSONStreamParser::AddChunk(__in_bcount(length) const byte* chunk, size_t length, bool isLastChunk)
+    {
+        Assert(!hasFailed && !isComplete);
+
+        AppendPending(chunk, length);
+
+        // alignment required because of the union in JSONParser::m_token
+        __declspec (align(8)) JSONParser parser(scriptContext, nullptr);
+        TryFinally([&]()
+        {
+            ScanPending(parser);
+
+            if (isLastChunk)
+            {
+                // A number or literal at the very end has no delimiter after it
+                if (inScalar)
+                {
+                    CompleteValue(parser, pendingLength);
+                }
+
+                if (inValue || depth != 0 || (mode == ArrayElements && arrayState != AfterArray))
+                {
+                    ThrowSyntaxError();
+                }
+                isComplete = true;
+            }
+        },
+            [&](bool hasException)
+        {
+            parser.Finalizer();
+            if (hasException)
+            {
+                hasFailed = true;
+            }
+        });
+
+        DiscardScanned();
+    }
+
+    Js::Var JSONStreamParser::GetNextValue()
+    {
+        if (nextValueIndex == values.Count())
+        {
+            return nullptr;
+        }
+
+        Js::Var value = values.Item(nextValueIndex++);
+        if (nextValueIndex == values.Count())
+        {
+            values.Clear();
+            nextValueIndex = 0;
+        }
+
+        // The caller holds it from here on
+        if (!TaggedNumber::Is(value))
+        {
+            scriptContext->GetRecycler()->RootRelease(value);
+        }
+        return value;
+    }
+
+    void JSONStreamParser::AppendPending(__in_bcount(length) const byte* chunk, size_t length)
+    {
+        size_t requiredCapacity = AllocSizeMath::Add(pendingLength, length);
+        if (requiredCapacity > pendingCapacity)
+        {
+            size_t newCapacity = max(requiredCapacity, max(pendingCapacity * 2, (size_t)4096));
+
+            byte* newPending = HeapNewArray(byte, newCapacity);
+            if (pending != nullptr)
+            {
+                js_memcpy_s(newPending, newCapacity, pending, pendingLength);
+                HeapDeleteArray(pendingCapacity, pending);
+            }
+            pending = newPending;
+            pendingCapacity = newCapacity;
+        }
+
+        js_memcpy_s(pending + pendingLength, pendingCapacity - pendingLength, chunk, length);
+        pendingLength += length;
+    }
+
+    void JSONStreamParser::DiscardScanned()
+    {
+        // Only the value in progress needs to be kept
+        size_t keepFrom = inValue ? valueStart : scanOffset;
+        if (keepFrom == 0)
+        {
+            return;
+        }
+
+        size_t keepLength = pendingLength - keepFrom;
+        memmove(pending, pending + keepFrom, keepLength);
+        pendingLength = keepLength;
+        scanOffset -= keepFrom;
+        valueStart = inValue ? valueStart - keepFrom : 0;
+    }
+
+    bool JSONStreamParser::IsScalarByte(byte c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' || c == '+' || c == '.';
+    }
+
+    void JSONStreamParser::ScanPending(JSONParser& parser)
+    {
+        // Values are returned when they are complete at this nesting level
+        const uint valueDepth = (mode == ArrayElements) ? 1 : 0;
+
+        for (; scanOffset < pendingLength; scanOffset++)
+        {
+            const byte c = pending[scanOffset];
+
+            if (inString)
+            {
+                // UTF-8 continuation bytes are never ASCII, so quotes and backslashes can't be mistaken
+                if (escaped)
+                {
+                    escaped = false;
+                }
+                else if (c == '\\')
+                {
+                    escaped = true;
+                }
+                else if (c == '"')
+                {
+                    inString = false;
+                    if (depth == valueDepth)
+                    {
+                        CompleteValue(parser, scanOffset + 1);
+                    }
+                }
+                continue;
+            }
+
+            if (inScalar)
+            {
+                if (IsScalarByte(c))
+                {
+                    continue;
+                }
+                CompleteValue(parser, scanOffset);
+            }
+
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+            {
+                continue;
+            }
+
+            if (depth < valueDepth)
+            {
+                // Outside of the top-level array there can only be its opening bracket
+                if (c != '[' || arrayState != BeforeArray)
+                {
+                    ThrowSyntaxError();
+                }
+                arrayState = ExpectFirstElement;
+                depth++;
+                continue;
+            }
+
+            switch (c)
+            {
+            case '"':
+                if (depth == valueDepth)
+                {
+                    StartValue(scanOffset);
+                }
+                inString = true;
+                break;
+
+            case '{':
+            case '[':
+                if (depth == valueDepth)
+                {
+                    StartValue(scanOffset);
+                }
+                depth = UInt32Math::Add(depth, 1);
+                break;
+
+            case '}':
+            case ']':
+                if (depth == valueDepth)
+                {
+                    // Only the top-level array may be closed here. Mismatched brackets inside a
+                    // value are reported by JSONParser when the value is parsed.
+                    if (mode != ArrayElements || c != ']' || (arrayState != ExpectFirstElement && arrayState != AfterElement))
+                    {
+                        ThrowSyntaxError();
+                    }
+                    arrayState = AfterArray;
+                    depth--;
+                    break;
+                }
+
+                depth--;
+                if (depth == valueDepth)
+                {
+                    CompleteValue(parser, scanOffset + 1);
+                }
+                break;
+
+            case ',':
+                if (depth == valueDepth)
+                {
+                    if (mode != ArrayElements || arrayState != AfterElement)
+                    {
+                        ThrowSyntaxError();
+                    }
+                    arrayState = ExpectElement;
+                }
+                break;
+
+            default:
+                if (depth == valueDepth)
+                {
+                    StartValue(scanOffset);
+                    inScalar = true;
+                }
+                break;
+            }
+        }
+    }
+
+    void JSONStreamParser::StartValue(size_t start)
+    {
+        Assert(!inValue);
+        if (mode == ArrayElements)
+        {
+            if (arrayState != ExpectFirstElement && arrayState != ExpectElement)
+            {
+                ThrowSyntaxError();
+            }
+        }
+
+        inValue = true;
+        valueStart = start;
+    }
+
+    void JSONStreamParser::CompleteValue(JSONParser& parser, size_t end)
+    {
+        Assert(inValue && end > valueStart);
+
+        size_t byteCount = end - valueStart;
+        if (byteCount >= UINT_MAX)
+        {
+            Js::Throw::OutOfMemory();
+        }
+
+        // UTF-8 never takes fewer bytes than UTF-16 takes characters
+        if (decodeBufferLength < byteCount + 1)
+        {
+            if (decodeBuffer != nullptr)
+            {
+                HeapDeleteArray(decodeBufferLength, decodeBuffer);
+                decodeBuffer = nullptr;
+                decodeBufferLength = 0;
+            }
+            decodeBuffer = HeapNewArray(char16, byteCount + 1);
+            decodeBufferLength = byteCount + 1;
+        }
+
+        LPCUTF8 text = pending + valueStart;
+        size_t charCount = utf8::DecodeUnitsIntoAndNullTerminate(decodeBuffer, text, text + byteCount, utf8::doAllowInvalidWCHARs);
+
+        Js::Var value = parser.Parse(decodeBuffer, (uint)charCount);
+        if (!TaggedNumber::Is(value))
+        {
+            scriptContext->GetRecycler()->RootAddRef(value);
+        }
+        values.Add(value);
+
+        inValue = false;
+        inScalar = false;
+        if (mode == ArrayElements)
+        {
+            arrayState = AfterElement;
+        }
+    }
+
+    void JSONStreamParser::ThrowSyntaxError()
+    {
+        Js::JavascriptError::ThrowSyntaxError(scriptContext, JSERR_JsonSyntax);
+    }
+} // namespace JSON
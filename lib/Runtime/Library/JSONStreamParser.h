@@ -0,0 +1,86 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JSON
+{
+    class JSONParser;
+
+    // Parses UTF-8 JSON text that arrives in chunks, such as an NDJSON feed or one large array.
+    // Only the boundaries of values are tracked while the bytes come in (nesting depth and whether
+    // we are inside a string); as soon as a value is complete its text is handed to JSONParser and
+    // dropped. The memory held is therefore bounded by the largest single value, not by the stream.
+    //
+    // Completed values are kept alive with RootAddRef until the host takes them with GetNextValue.
+    class JSONStreamParser
+    {
+    public:
+        enum Mode
+        {
+            // A sequence of top-level values separated by whitespace (NDJSON)
+            Values,
+            // A single top-level array; each element is returned as soon as it is complete
+            ArrayElements
+        };
+
+        JSONStreamParser(Js::ScriptContext* scriptContext, Mode mode);
+        ~JSONStreamParser();
+
+        Js::ScriptContext* GetScriptContext() const { return scriptContext; }
+        bool HasFailed() const { return hasFailed; }
+        bool IsComplete() const { return isComplete; }
+
+        // Throws a SyntaxError if the text so far can't be JSON; the stream can't be used after that
+        void AddChunk(__in_bcount(length) const byte* chunk, size_t length, bool isLastChunk);
+
+        // Returns nullptr if no value has been completed since the last call
+        Js::Var GetNextValue();
+
+    private:
+        enum ArrayState
+        {
+            BeforeArray,
+            ExpectFirstElement,
+            ExpectElement,
+            AfterElement,
+            AfterArray
+        };
+
+        void AppendPending(__in_bcount(length) const byte* chunk, size_t length);
+        void DiscardScanned();
+        void ScanPending(JSONParser& parser);
+        void StartValue(size_t start);
+        void CompleteValue(JSONParser& parser, size_t end);
+        void __declspec(noreturn) ThrowSyntaxError();
+
+        static bool IsScalarByte(byte c);
+
+        Js::ScriptContext* scriptContext;
+        Mode mode;
+
+        // Bytes received but not yet part of a completed value
+        byte* pending;
+        size_t pendingLength;
+        size_t pendingCapacity;
+        size_t scanOffset;
+
+        // Buffer the text of a completed value is decoded into for JSONParser
+        char16* decodeBuffer;
+        size_t decodeBufferLength;
+
+        size_t valueStart;
+        uint depth;
+        ArrayState arrayState;
+        bool inValue;
+        bool inString;
+        bool inScalar;
+        bool escaped;
+        bool hasFailed;
+        bool isComplete;
+
+        JsUtil::List<Js::Var, HeapAllocator> values;
+        int nextValueIndex;
+    };
+} // namespace JSON
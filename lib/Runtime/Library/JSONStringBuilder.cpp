@@ -4,43 +4,88 @@
 //-------------------------------------------------------------------------------------------------------
 
 #include "RuntimeLibraryPch.h"
+#include "Codex/Utf8Codex.h"
 
 namespace Js
 {
 
 void
-JSONStringBuilder::AppendCharacter(char16 character)
+JSONUtf8Writer::AppendBuffer(_In_ const char16* buffer, charcount_t length)
 {
-    AssertOrFailFast(this->currentLocation < endLocation);
-    *this->currentLocation = character;
-    ++this->currentLocation;
+    while (length > 0)
+    {
+        if (this->stagedCount == StagingLength)
+        {
+            this->Flush(false);
+        }
+
+        const charcount_t count = min(length, StagingLength - this->stagedCount);
+        wmemcpy_s(this->staged + this->stagedCount, StagingLength - this->stagedCount, buffer, count);
+        this->stagedCount += count;
+        buffer += count;
+        length -= count;
+    }
 }
 
 void
-JSONStringBuilder::AppendBuffer(_In_ const char16* buffer, charcount_t length)
+JSONUtf8Writer::Flush(bool isFinal)
 {
-    AssertOrFailFast(this->currentLocation + length <= endLocation);
-    wmemcpy_s(this->currentLocation, length, buffer, length);
-    this->currentLocation += length;
+    charcount_t count = this->stagedCount;
+
+    // Hold back a trailing high surrogate so that it is encoded together with the low surrogate that follows
+    if (!isFinal && count > 0 && NumberUtilities::IsSurrogateUpperPart(this->staged[count - 1]))
+    {
+        --count;
+    }
+
+    const size_t byteCount = utf8::EncodeTrueUtf8IntoBoundsChecked(this->encoded, this->staged, count, this->encoded + sizeof(this->encoded));
+    if (byteCount > 0)
+    {
+        this->WriteChunk(this->encoded, byteCount);
+        this->writtenByteCount += byteCount;
+    }
+
+    if (count < this->stagedCount)
+    {
+        this->staged[0] = this->staged[count];
+        this->stagedCount = 1;
+    }
+    else
+    {
+        this->stagedCount = 0;
+    }
 }
 
+template <class TWriter>
 void
-JSONStringBuilder::AppendString(_In_ JavascriptString* str)
+JSONStringBuilder<TWriter>::AppendString(_In_ JavascriptString* str)
 {
     AppendBuffer(str->GetString(), str->GetLength());
 }
 
+template <class TWriter>
 void
-JSONStringBuilder::EscapeAndAppendString(_In_ JavascriptString* str)
+JSONStringBuilder<TWriter>::EscapeAndAppendString(_In_ JavascriptString* str)
 {
     const charcount_t strLength = str->GetLength();
 
     // Strings should be surrounded by double quotes
     this->AppendCharacter(_u('"'));
     const char16* bufferStart = str->GetString();
-    for (const char16* index = bufferStart; index < bufferStart + strLength; ++index)
+    const char16* bufferEnd = bufferStart + strLength;
+    const char16* runStart = bufferStart;
+    for (const char16* index = bufferStart; index < bufferEnd; ++index)
     {
         char16 currentCharacter = *index;
+        if (currentCharacter >= _u(' ') && currentCharacter != _u('"') && currentCharacter != _u('\\'))
+        {
+            // Characters that don't need escaping are appended a run at a time
+            continue;
+        }
+
+        this->AppendBuffer(runStart, static_cast<charcount_t>(index - runStart));
+        runStart = index + 1;
+
         switch (currentCharacter)
         {
         case _u('"'):
@@ -70,45 +115,42 @@ JSONStringBuilder::EscapeAndAppendString(_In_ JavascriptString* str)
             this->AppendCharacter(_u('t'));
             break;
         default:
-            if (currentCharacter < _u(' '))
-            {
-                // If character is less than SPACE, it is converted into a 4 digit hex code (e.g. \u0010)
-                this->AppendCharacter(_u('\\'));
-                this->AppendCharacter(_u('u'));
-                {
-                    char16 buf[5];
-                    // Get hex value
-                    _ltow_s(currentCharacter, buf, _countof(buf), 16);
-
-                    // Append leading zeros if necessary before the hex value
-                    charcount_t count = static_cast<charcount_t>(wcslen(buf));
-                    switch (count)
-                    {
-                    case 1:
-                        this->AppendCharacter(_u('0'));
-                    case 2:
-                        this->AppendCharacter(_u('0'));
-                    case 3:
-                        this->AppendCharacter(_u('0'));
-                    default:
-                        this->AppendBuffer(buf, count);
-                        break;
-                    }
-                }
-            }
-            else
+        {
+            // If character is less than SPACE, it is converted into a 4 digit hex code (e.g. \u0010)
+            Assert(currentCharacter < _u(' '));
+            this->AppendCharacter(_u('\\'));
+            this->AppendCharacter(_u('u'));
+
+            char16 buf[5];
+            // Get hex value
+            _ltow_s(currentCharacter, buf, _countof(buf), 16);
+
+            // Append leading zeros if necessary before the hex value
+            charcount_t count = static_cast<charcount_t>(wcslen(buf));
+            switch (count)
             {
-                this->AppendCharacter(currentCharacter);
+            case 1:
+                this->AppendCharacter(_u('0'));
+            case 2:
+                this->AppendCharacter(_u('0'));
+            case 3:
+                this->AppendCharacter(_u('0'));
+            default:
+                this->AppendBuffer(buf, count);
+                break;
             }
             break;
         }
+        }
     }
 
+    this->AppendBuffer(runStart, static_cast<charcount_t>(bufferEnd - runStart));
     this->AppendCharacter(_u('"'));
 }
 
+template <class TWriter>
 void
-JSONStringBuilder::AppendGap(uint32 count)
+JSONStringBuilder<TWriter>::AppendGap(uint32 count)
 {
     for (uint i = 0; i < count; ++i)
     {
@@ -116,8 +158,9 @@ JSONStringBuilder::AppendGap(uint32 count)
     }
 }
 
+template <class TWriter>
 void
-JSONStringBuilder::AppendObjectString(_In_ JSONObject* valueList)
+JSONStringBuilder<TWriter>::AppendObjectString(_In_ JSONObject* valueList)
 {
     const uint elementCount = valueList->Count();
     if (elementCount == 0)
@@ -177,8 +220,9 @@ JSONStringBuilder::AppendObjectString(_In_ JSONObject* valueList)
     this->indentLevel = stepbackLevel;
 }
 
+template <class TWriter>
 void
-JSONStringBuilder::AppendArrayString(_In_ JSONArray* valueArray)
+JSONStringBuilder<TWriter>::AppendArrayString(_In_ JSONArray* valueArray)
 {
     uint32 length = valueArray->length;
     if (length == 0)
@@ -228,8 +272,9 @@ JSONStringBuilder::AppendArrayString(_In_ JSONArray* valueArray)
     this->indentLevel = stepbackLevel;
 }
 
+template <class TWriter>
 void
-JSONStringBuilder::AppendJSONPropertyString(_In_ JSONProperty* prop)
+JSONStringBuilder<TWriter>::AppendJSONPropertyString(_In_ JSONProperty* prop)
 {
     switch (prop->type)
     {
@@ -259,25 +304,23 @@ JSONStringBuilder::AppendJSONPropertyString(_In_ JSONProperty* prop)
     }
 }
 
+template <class TWriter>
 void
-JSONStringBuilder::Build()
+JSONStringBuilder<TWriter>::Build()
 {
     this->AppendJSONPropertyString(this->jsonContent);
-    // Null terminate the string
-    AssertOrFailFast(this->currentLocation == endLocation);
-    *this->currentLocation = _u('\0');
+    this->writer->Finish();
 }
 
-JSONStringBuilder::JSONStringBuilder(
+template <class TWriter>
+JSONStringBuilder<TWriter>::JSONStringBuilder(
     _In_ ScriptContext* scriptContext,
     _In_ JSONProperty* jsonContent,
-    _In_ char16* buffer,
-    charcount_t bufferLength,
+    _In_ TWriter* writer,
     _In_opt_ const char16* gap,
     charcount_t gapLength) :
         scriptContext(scriptContext),
-        endLocation(buffer + bufferLength - 1),
-        currentLocation(buffer),
+        writer(writer),
         jsonContent(jsonContent),
         gap(gap),
         gapLength(gapLength),
@@ -285,4 +328,7 @@ JSONStringBuilder::JSONStringBuilder(
 {
 }
 
+template class JSONStringBuilder<JSONCharBufferWriter>;
+template class JSONStringBuilder<JSONUtf8Writer>;
+
 } //namespace Js
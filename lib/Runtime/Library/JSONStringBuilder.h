@@ -8,20 +8,93 @@
 namespace Js
 {
 
-class JSONStringBuilder
+// Output for JSONStringBuilder into a char16 buffer sized to the exact length of the string
+class JSONCharBufferWriter
 {
 private:
-    ScriptContext* scriptContext;
     const char16* endLocation;
     char16* currentLocation;
+
+public:
+    JSONCharBufferWriter(_In_ char16* buffer, charcount_t bufferLength) :
+        endLocation(buffer + bufferLength - 1),
+        currentLocation(buffer)
+    {
+    }
+
+    void AppendCharacter(char16 character)
+    {
+        AssertOrFailFast(this->currentLocation < endLocation);
+        *this->currentLocation = character;
+        ++this->currentLocation;
+    }
+
+    void AppendBuffer(_In_ const char16* buffer, charcount_t length)
+    {
+        AssertOrFailFast(this->currentLocation + length <= endLocation);
+        wmemcpy_s(this->currentLocation, length, buffer, length);
+        this->currentLocation += length;
+    }
+
+    void Finish()
+    {
+        // Null terminate the string
+        AssertOrFailFast(this->currentLocation == endLocation);
+        *this->currentLocation = _u('\0');
+    }
+};
+
+// Output for JSONStringBuilder as UTF-8, handed to WriteChunk a few KB at a time. Characters are
+// staged in a small fixed buffer and transcoded in blocks, so the char16 string is never built.
+class JSONUtf8Writer
+{
+private:
+    static const charcount_t StagingLength = 1024;
+
+    size_t writtenByteCount;
+    charcount_t stagedCount;
+    char16 staged[StagingLength];
+    byte encoded[StagingLength * 3];
+
+    void Flush(bool isFinal);
+
+protected:
+    virtual void WriteChunk(_In_reads_bytes_(length) const byte* chunk, size_t length) = 0;
+
+public:
+    JSONUtf8Writer() : writtenByteCount(0), stagedCount(0) {}
+
+    void AppendCharacter(char16 character)
+    {
+        if (this->stagedCount == StagingLength)
+        {
+            this->Flush(false);
+        }
+        this->staged[this->stagedCount++] = character;
+    }
+
+    void AppendBuffer(_In_ const char16* buffer, charcount_t length);
+    void Finish() { this->Flush(true); }
+
+    size_t GetWrittenByteCount() const { return this->writtenByteCount; }
+};
+
+// Walks the JSONProperty tree of a LazyJSONString and writes its text to TWriter. Instantiated for
+// JSONCharBufferWriter and JSONUtf8Writer in JSONStringBuilder.cpp.
+template <class TWriter>
+class JSONStringBuilder
+{
+private:
+    ScriptContext* scriptContext;
+    TWriter* writer;
     JSONProperty* jsonContent;
     const char16* gap;
     charcount_t gapLength;
     uint32 indentLevel;
 
     void AppendGap(uint32 count);
-    void AppendCharacter(char16 character);
-    void AppendBuffer(_In_ const char16* buffer, charcount_t length);
+    void AppendCharacter(char16 character) { this->writer->AppendCharacter(character); }
+    void AppendBuffer(_In_ const char16* buffer, charcount_t length) { this->writer->AppendBuffer(buffer, length); }
     void AppendString(_In_ JavascriptString* str);
     void EscapeAndAppendString(_In_ JavascriptString* str);
     void AppendObjectString(_In_ JSONObject* valueList);
@@ -31,8 +104,7 @@ class JSONStringBuilder
     JSONStringBuilder(
         _In_ ScriptContext* scriptContext,
         _In_ JSONProperty* jsonContent,
-        _In_ char16* buffer,
-        charcount_t bufferLength,
+        _In_ TWriter* writer,
         _In_opt_ const char16* gap,
         charcount_t gapLength);
     void Build();
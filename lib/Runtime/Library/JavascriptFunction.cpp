@@ -692,9 +692,8 @@ namespace Js
 #endif
 
 #ifdef DISABLE_SEH
-        // xplat: JavascriptArrayBuffer::AllocWrapper is disabled on cross-platform
-        // (IsValidVirtualBufferLength always returns false).
-        // SEH and ResumeForOutOfBoundsArrayRefs are not needed.
+        // xplat: there is no SEH to scope ResumeForOutOfBoundsArrayRefs to this call, so the PAL's
+        // SIGSEGV handler runs it for us; see HardwareExceptionFilter.
         ret = JavascriptFunction::CallRootFunctionInternal(obj, args, scriptContext, inScript);
 #else
         if (scriptContext->GetThreadContext()->GetAbnormalExceptionCode() != 0)
@@ -2263,6 +2262,13 @@ void __cdecl _alloca_probe_16()
     }
 
 #if ENABLE_FAST_ARRAYBUFFER
+#ifndef _WIN32
+    static void ThrowWasmOutOfBoundsTrap(ScriptContext* scriptContext)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(scriptContext, WASMERR_ArrayIndexOutOfRange);
+    }
+#endif
+
     bool ResumeForOutOfBoundsArrayRefs(int exceptionCode, ExceptionFilterHelper& helper)
     {
         if (exceptionCode != STATUS_ACCESS_VIOLATION)
@@ -2365,7 +2371,19 @@ void __cdecl _alloca_probe_16()
 
         if (isWasmOnly)
         {
+#ifdef _WIN32
             JavascriptError::ThrowWebAssemblyRuntimeError(func->GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+#else
+            // xplat: we're in a signal handler, which the C++ unwinder can't throw out of. Resume as if the
+            // faulting instruction had called ThrowWasmOutOfBoundsTrap, so the throw starts from the JIT'd frame.
+            PCONTEXT context = exceptionInfo->ContextRecord;
+            Assert(context->Rsp % 16 == 0);
+            context->Rsp -= sizeof(DWORD64);
+            *(DWORD64*)context->Rsp = context->Rip;
+            context->Rdi = (DWORD64)func->GetScriptContext();
+            context->Rip = (DWORD64)ThrowWasmOutOfBoundsTrap;
+            return true;
+#endif
         }
 
         // SIMD loads/stores do bounds checks.
@@ -2430,6 +2448,24 @@ void __cdecl _alloca_probe_16()
         return EXCEPTION_CONTINUE_SEARCH;
     }
 
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+    LONG JavascriptFunction::HardwareExceptionFilter(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        // Unlike the __except filter in CallRootFunction, this runs in the SIGSEGV handler for faults on
+        // every thread, in whatever state the thread was in. Only faults in JIT'd code can be out of bounds
+        // array accesses, and JIT'd code never holds a lock, so rule everything else out without taking one.
+        if (!CodeRegionTable::Contains(exceptionInfo->ExceptionRecord->ExceptionAddress))
+        {
+            return EXCEPTION_CONTINUE_SEARCH;
+        }
+        if (ThreadContext::GetContextForCurrentThread() == nullptr)
+        {
+            return EXCEPTION_CONTINUE_SEARCH;
+        }
+        return CallRootEventFilter(exceptionInfo->ExceptionRecord->ExceptionCode, exceptionInfo);
+    }
+#endif
+
 #if DBG
     void JavascriptFunction::VerifyEntryPoint()
     {
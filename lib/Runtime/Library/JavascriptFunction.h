@@ -148,6 +148,9 @@ namespace Js
         static Var EntrySpreadCall(const Js::AuxArray<uint32> *spreadIndices, RecyclableObject* function, CallInfo callInfo, ...);
         static void CheckAlignment();
         static BOOL IsNativeAddress(ScriptContext * scriptContext, void * codeAddr);
+#if ENABLE_FAST_ARRAYBUFFER && defined(DISABLE_SEH)
+        static LONG HardwareExceptionFilter(PEXCEPTION_POINTERS exceptionInfo);
+#endif
         static Var DeferredParsingThunk(RecyclableObject* function, CallInfo callInfo, ...);
         static JavascriptMethod DeferredParse(ScriptFunction** function);
         static JavascriptMethod DeferredParseCore(ScriptFunction** function, BOOL &fParsed);
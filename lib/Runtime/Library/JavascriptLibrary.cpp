@@ -2743,7 +2743,8 @@ namespace Js
 
     void JavascriptLibrary::InitializeComplexThings()
     {
-        emptyRegexPattern = RegexHelper::CompileDynamic(scriptContext, _u(""), 0, _u(""), 0, false);
+        // Compiled on first use; most contexts never construct an empty RegExp
+        emptyRegexPattern = nullptr;
 
         Recycler *const recycler = GetRecycler();
 
@@ -2757,7 +2758,7 @@ namespace Js
         // Instead, we just create an ordinary object prototype for RegExp.prototype in InitializePrototypes.
         if (!scriptConfig->IsES6PrototypeChain() && regexPrototype == nullptr)
         {
-            regexPrototype = RecyclerNew(recycler, JavascriptRegExp, emptyRegexPattern,
+            regexPrototype = RecyclerNew(recycler, JavascriptRegExp, GetEmptyRegexPattern(),
                 DynamicType::New(scriptContext, TypeIds_RegEx, objectPrototype, nullptr,
                 DeferredTypeHandler<InitializeRegexPrototype, DefaultDeferredTypeFilter, true>::GetDefaultInstance()));
         }
@@ -4881,10 +4882,13 @@ namespace Js
         return LiteralStringWithPropertyStringPtr::CreateEmptyString(this);
     }
 
-    JavascriptRegExp* JavascriptLibrary::CreateEmptyRegExp()
+    UnifiedRegex::RegexPattern * JavascriptLibrary::GetEmptyRegexPattern()
     {
-        return RecyclerNew(scriptContext->GetRecycler(), JavascriptRegExp, emptyRegexPattern,
-                           this->GetRegexType());
+        if (emptyRegexPattern == nullptr)
+        {
+            emptyRegexPattern = RegexHelper::CompileDynamic(scriptContext, _u(""), 0, _u(""), 0, false);
+        }
+        return emptyRegexPattern;
     }
 
 #if ENABLE_TTD
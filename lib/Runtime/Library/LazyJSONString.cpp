@@ -141,11 +141,11 @@ LazyJSONString::GetSz()
     Recycler* recycler = GetScriptContext()->GetRecycler();
     char16* target = RecyclerNewArrayLeaf(recycler, char16, allocSize);
 
-    JSONStringBuilder builder(
+    JSONCharBufferWriter writer(target, allocSize);
+    JSONStringBuilder<JSONCharBufferWriter> builder(
         this->GetScriptContext(),
         this->jsonContent,
-        target,
-        allocSize,
+        &writer,
         this->gap,
         this->gapLength);
 
@@ -160,6 +160,27 @@ LazyJSONString::GetSz()
     return target;
 }
 
+void
+LazyJSONString::WriteUtf8(_In_ JSONUtf8Writer* writer)
+{
+    if (this->IsFinalized())
+    {
+        // The metadata is gone once the string has been built, so transcode the string itself
+        writer->AppendBuffer(this->UnsafeGetBuffer(), this->GetLength());
+        writer->Finish();
+        return;
+    }
+
+    JSONStringBuilder<JSONUtf8Writer> builder(
+        this->GetScriptContext(),
+        this->jsonContent,
+        writer,
+        this->gap,
+        this->gapLength);
+
+    builder.Build();
+}
+
 // static
 bool
 LazyJSONString::Is(Var var)
@@ -10,6 +10,7 @@ namespace Js
 struct JSONObjectProperty;
 struct JSONProperty;
 struct JSONArray;
+class JSONUtf8Writer;
 
 enum class JSONContentType : uint8
 {
@@ -100,6 +101,9 @@ class LazyJSONString : JavascriptString
 
     const char16* GetSz() override sealed;
 
+    // Writes the string as UTF-8 straight from the metadata, without building the char16 buffer
+    void WriteUtf8(_In_ JSONUtf8Writer* writer);
+
     static bool Is(Var var);
 
     static LazyJSONString* TryFromVar(Var var);
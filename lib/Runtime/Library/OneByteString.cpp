@@ -0,0 +1,116 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+#include "Codex/Utf8Codex.h"
+
+namespace Js
+{
+    OneByteString::OneByteString(const char * oneByteBuffer, const CharCount charLength, JavascriptLibrary *const library) :
+        LiteralStringWithPropertyStringPtr(library->GetStringTypeStatic()),
+        oneByteBuffer(oneByteBuffer)
+    {
+        // Use SetLength to ensure length is valid
+        SetLength(charLength);
+    }
+
+    OneByteString * OneByteString::TryNewFromAsciiCString(const char * cString, const CharCount charCount, JavascriptLibrary *const library)
+    {
+        Assert(library != nullptr && cString != nullptr);
+
+        if (utf8::AsciiPrefixLength((LPCUTF8)cString, charCount) != charCount)
+        {
+            return nullptr;
+        }
+
+        ScriptContext * scriptContext = library->GetScriptContext();
+        if (charCount > MaxCharCount)
+        {
+            Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        Recycler * recycler = library->GetRecycler();
+        char * destString = RecyclerNewArrayLeaf(recycler, char, charCount);
+        js_memcpy_s(destString, charCount, cString, charCount);
+
+        return RecyclerNew(recycler, OneByteString, destString, charCount, library);
+    }
+
+    void OneByteString::WidenInto(_Out_writes_(m_charLength) char16 *const buffer) const
+    {
+        Assert(!this->IsFinalized());
+
+        const CharCount charLength = this->GetLength();
+        const unsigned char * source = (const unsigned char *)this->oneByteBuffer;
+        for (CharCount i = 0; i < charLength; i++)
+        {
+            buffer[i] = (char16)source[i];
+        }
+    }
+
+    void OneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+
+        // Widen straight into the destination; flattening a concat string doesn't need our own char16 buffer
+        WidenInto(buffer);
+    }
+
+    const char16 * OneByteString::GetSz()
+    {
+        AssertCanHandleOutOfMemory();
+        Assert(!this->IsFinalized());
+
+        const CharCount charLength = this->GetLength();
+        char16 * target = RecyclerNewArrayLeaf(this->GetRecycler(), char16, SafeSzSize());
+        WidenInto(target);
+        target[charLength] = _u('\0');
+
+        SetBuffer(target);
+        this->oneByteBuffer = nullptr;
+
+        // From here on this is an ordinary literal string. Unlike ConvertString, keep the property record.
+        VirtualTableInfo<LiteralStringWithPropertyStringPtr>::SetVirtualTable(this);
+        return JavascriptString::GetSz();
+    }
+
+    size_t OneByteString::GetAllocatedByteCount() const
+    {
+        if (!this->IsFinalized())
+        {
+            return this->GetLength();
+        }
+        return __super::GetAllocatedByteCount();
+    }
+
+    size_t OneByteString::CopyToUtf8(_Out_writes_opt_(bufferSize) char * buffer, size_t bufferSize) const
+    {
+        Assert(!this->IsFinalized());
+
+        const size_t charLength = this->GetLength();
+        if (buffer == nullptr)
+        {
+            return charLength;
+        }
+
+        const size_t byteCount = min(charLength, bufferSize);
+        js_memcpy_s(buffer, bufferSize, this->oneByteBuffer, byteCount);
+        return byteCount;
+    }
+
+    /* static */
+    bool OneByteString::Is(Var var)
+    {
+        return RecyclableObject::Is(var) && VirtualTableInfo<Js::OneByteString>::HasVirtualTable(RecyclableObject::UnsafeFromVar(var));
+    }
+
+    /* static */
+    OneByteString * OneByteString::TryFromVar(Var var)
+    {
+        return OneByteString::Is(var) ? reinterpret_cast<OneByteString*>(var) : nullptr;
+    }
+}
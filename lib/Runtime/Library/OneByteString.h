@@ -0,0 +1,41 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // A string whose characters are all ASCII, stored one byte per character.
+    // The char16 buffer is only created when something asks for it (GetString or GetSz), at which
+    // point the one-byte buffer is dropped and the object becomes a LiteralStringWithPropertyStringPtr.
+    // Until then, copying it into a flattened concat string or out to UTF-8 reads the bytes directly;
+    // since ASCII is its own UTF-8 encoding, the latter is a plain copy.
+    class OneByteString sealed : public LiteralStringWithPropertyStringPtr
+    {
+    private:
+        Field(const char *) oneByteBuffer;
+
+        OneByteString(const char * oneByteBuffer, const CharCount charLength, JavascriptLibrary *const library);
+        void WidenInto(_Out_writes_(m_charLength) char16 *const buffer) const;
+
+    protected:
+        DEFINE_VTABLE_CTOR(OneByteString, LiteralStringWithPropertyStringPtr);
+
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer,
+            StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+
+    public:
+        // Returns nullptr if the content isn't all ASCII, so that the caller can fall back to decoding it
+        static OneByteString * TryNewFromAsciiCString(const char * cString, const CharCount charCount, JavascriptLibrary *const library);
+
+        virtual const char16* GetSz() override;
+        virtual size_t GetAllocatedByteCount() const override;
+
+        // Same contract as utf8::WideStringToNarrowNoAlloc: with a null buffer, returns the number of bytes needed
+        size_t CopyToUtf8(_Out_writes_opt_(bufferSize) char * buffer, size_t bufferSize) const;
+
+        static bool Is(Var var);
+        static OneByteString * TryFromVar(Var var);
+    };
+}
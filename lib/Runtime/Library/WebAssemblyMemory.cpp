@@ -177,6 +177,33 @@ WebAssemblyMemory::GrowHelper(WebAssemblyMemory * mem, uint32 deltaPages)
     return mem->GrowInternal(deltaPages);
 }
 
+void
+WebAssemblyMemory::CopyHelper(WebAssemblyMemory * mem, uint32 dst, uint32 src, uint32 count)
+{
+    // Check the whole range once, nothing is written if either end is out of bounds
+    const uint64 byteLength = mem->m_buffer->GetByteLength();
+    if ((uint64)dst + count > byteLength || (uint64)src + count > byteLength)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(mem->GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+
+    // The ranges may overlap
+    BYTE* buffer = mem->m_buffer->GetBuffer();
+    memmove(buffer + dst, buffer + src, count);
+}
+
+void
+WebAssemblyMemory::FillHelper(WebAssemblyMemory * mem, uint32 dst, int32 value, uint32 count)
+{
+    if ((uint64)dst + count > mem->m_buffer->GetByteLength())
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(mem->GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+
+    BYTE* buffer = mem->m_buffer->GetBuffer();
+    memset(buffer + dst, (uint8)value, count);
+}
+
 #if DBG
 void WebAssemblyMemory::TraceMemWrite(WebAssemblyMemory* mem, uint32 index, uint32 offset, Js::ArrayBufferView::ViewType viewType, uint32 bytecodeOffset, ScriptContext* context)
 {
@@ -40,6 +40,8 @@ namespace Js
 
         int32 GrowInternal(uint32 deltaPages);
         static int32 GrowHelper(Js::WebAssemblyMemory * memory, uint32 deltaPages);
+        static void CopyHelper(Js::WebAssemblyMemory * memory, uint32 dst, uint32 src, uint32 count);
+        static void FillHelper(Js::WebAssemblyMemory * memory, uint32 dst, int32 value, uint32 count);
 
         static int GetOffsetOfArrayBuffer() { return offsetof(WebAssemblyMemory, m_buffer); }
 #if DBG
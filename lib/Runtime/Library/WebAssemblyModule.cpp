@@ -234,14 +234,38 @@ WebAssemblyModule::CreateModule(
 
         webAssemblyModule = bytecodeGen.GenerateModule();
 
+        // With -WasmValidateUpfront, deferred bodies are validated now and their bytecode is still generated on first call
+#if ENABLE_NATIVE_CODEGEN
+        ArenaAllocator tmpAlloc(_u("WasmValidation"), scriptContext->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory);
+        Wasm::WasmParallelValidator* validator = nullptr;
+        if (Wasm::WasmParallelValidator::IsEnabled(scriptContext))
+        {
+            validator = Anew(&tmpAlloc, Wasm::WasmParallelValidator, scriptContext, webAssemblyModule, &tmpAlloc);
+        }
+        AutoAllocatorObjectPtr<Wasm::WasmParallelValidator, ArenaAllocator> autoValidator(validator, &tmpAlloc);
+        if (validator)
+        {
+            validator->ValidateDeferredFunctions();
+        }
+#endif
+
         for (uint i = 0; i < webAssemblyModule->GetWasmFunctionCount(); ++i)
         {
             currentBody = webAssemblyModule->GetWasmFunctionInfo(i)->GetBody();
+            readerInfo = currentBody->GetAsmJsFunctionInfo()->GetWasmReaderInfo();
             if (!PHASE_OFF(WasmDeferredPhase, currentBody))
             {
+                // Whatever didn't validate on the job threads is validated again here, in index order, to report the first error
+                if (CONFIG_FLAG(WasmValidateUpfront)
+#if ENABLE_NATIVE_CODEGEN
+                    && !(validator && validator->IsValidated(i))
+#endif
+                    )
+                {
+                    Wasm::WasmBytecodeGenerator::ValidateFunction(scriptContext, readerInfo);
+                }
                 continue;
             }
-            readerInfo = currentBody->GetAsmJsFunctionInfo()->GetWasmReaderInfo();
 
             Wasm::WasmBytecodeGenerator::GenerateFunctionBytecode(scriptContext, readerInfo);
         }
@@ -250,6 +250,31 @@ WebAssemblyTable::DirectGetValue(uint index) const
     return val;
 }
 
+void
+WebAssemblyTable::CopyHelper(WebAssemblyTable * table, uint32 dst, uint32 src, uint32 count)
+{
+    if ((uint64)dst + count > table->m_currentLength || (uint64)src + count > table->m_currentLength)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(table->GetScriptContext(), WASMERR_TableIndexOutOfRange);
+    }
+
+    // Copy element by element for the write barrier, backwards if the destination overlaps the end of the source
+    if (dst <= src)
+    {
+        for (uint32 i = 0; i < count; ++i)
+        {
+            table->m_values[dst + i] = table->m_values[src + i];
+        }
+    }
+    else
+    {
+        for (uint32 i = count; i > 0; --i)
+        {
+            table->m_values[dst + i - 1] = table->m_values[src + i - 1];
+        }
+    }
+}
+
 uint32
 WebAssemblyTable::GetCurrentLength() const
 {
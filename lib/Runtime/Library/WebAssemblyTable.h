@@ -44,6 +44,8 @@ namespace Js
         void DirectSetValue(uint index, Var val);
         Var DirectGetValue(uint index) const;
 
+        static void CopyHelper(Js::WebAssemblyTable * table, uint32 dst, uint32 src, uint32 count);
+
         static uint32 GetOffsetOfValues() { return offsetof(WebAssemblyTable, m_values); }
         static uint32 GetOffsetOfCurrentLength() { return offsetof(WebAssemblyTable, m_currentLength); }
     private:
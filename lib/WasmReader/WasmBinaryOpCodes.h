@@ -61,6 +61,8 @@
 #endif
 
 #define WASM_PREFIX_TRACING 0xf0
+#define WASM_PREFIX_BULK_MEMORY 0xfc
+WASM_PREFIX(BulkMemory, WASM_PREFIX_BULK_MEMORY, CONFIG_FLAG(WasmBulkMemory), "WebAssembly bulk memory support is not enabled")
 #if ENABLE_DEBUG_CONFIG_OPTIONS
 // We won't even look at that prefix in release builds
 // Mark the prefix as not implemented so we don't allow it in the binary buffer
@@ -326,6 +328,13 @@ WASM_UNARY__OPCODE(I64Extend8_s , 0xc2, L_L, I64Extend8_s , CONFIG_FLAG(WasmSign
 WASM_UNARY__OPCODE(I64Extend16_s, 0xc3, L_L, I64Extend16_s, CONFIG_FLAG(WasmSignExtends), "i64.extend16_s")
 WASM_UNARY__OPCODE(I64Extend32_s, 0xc4, L_L, I64Extend32_s, CONFIG_FLAG(WasmSignExtends), "i64.extend32_s")
 
+// Bulk memory operators
+#define __prefix (WASM_PREFIX_BULK_MEMORY << 8)
+WASM_MISC_OPCODE(MemoryCopy, __prefix | 0x0a, Limit, CONFIG_FLAG(WasmBulkMemory), "memory.copy")
+WASM_MISC_OPCODE(MemoryFill, __prefix | 0x0b, Limit, CONFIG_FLAG(WasmBulkMemory), "memory.fill")
+WASM_MISC_OPCODE(TableCopy,  __prefix | 0x0e, Limit, CONFIG_FLAG(WasmBulkMemory), "table.copy")
+#undef __prefix
+
 #if ENABLE_DEBUG_CONFIG_OPTIONS
 #define __prefix (WASM_PREFIX_TRACING << 8)
 WASM_UNARY__OPCODE(PrintFuncName    , __prefix | 0x00, V_I , PrintFuncName    , true, "")
@@ -346,6 +355,7 @@ WASM_UNARY__OPCODE(PrintF64         , __prefix | 0x0f, D_D , PrintF64         ,
 #endif
 
 #undef WASM_PREFIX_TRACING
+#undef WASM_PREFIX_BULK_MEMORY
 #undef WASM_PREFIX
 #undef WASM_OPCODE
 #undef WASM_SIGNATURE
@@ -400,6 +400,10 @@ void WasmBinaryReader::SeekToFunctionBody(class WasmFunctionInfo* funcInfo)
     uint32 numLocalsEntries = LEB128(length);
     m_funcState.count += length;
 
+    // Validating a body up front and generating its bytecode later both come through here
+    const bool addLocals = !funcInfo->AreLocalsRead();
+    uint32 localCount = funcInfo->GetParamCount();
+
     // locals
     for (uint32 j = 0; j < numLocalsEntries; j++)
     {
@@ -412,14 +416,20 @@ void WasmBinaryReader::SeekToFunctionBody(class WasmFunctionInfo* funcInfo)
         }
         m_funcState.count += length;
 
-        uint32 totalLocals = 0;
-        if (UInt32Math::Add(funcInfo->GetLocalCount(), numLocals, &totalLocals) || totalLocals > Limits::GetMaxFunctionLocals())
+        if (UInt32Math::Add(localCount, numLocals, &localCount) || localCount > Limits::GetMaxFunctionLocals())
         {
             ThrowDecodingError(_u("Too many locals"));
         }
-        funcInfo->AddLocal(type, numLocals);
+        if (addLocals)
+        {
+            funcInfo->AddLocal(type, numLocals);
+        }
         TRACE_WASM_DECODER(_u("Local: type = %s, count = %u"), WasmTypes::GetTypeName(type), numLocals);
     }
+    if (addLocals)
+    {
+        funcInfo->SetLocalsRead();
+    }
 }
 
 void WasmBinaryReader::FunctionEnd()
@@ -558,6 +568,11 @@ WasmOp WasmBinaryReader::ReadExpr()
         }
         break;
     }
+    case wbMemoryCopy:
+    case wbMemoryFill:
+    case wbTableCopy:
+        BulkMemoryNode(op);
+        break;
 #ifdef ENABLE_WASM_SIMD
     case wbV8X16Shuffle:
         ShuffleNode();
@@ -711,6 +726,31 @@ void WasmBinaryReader::MemNode()
     m_funcState.count += len;
 }
 
+void WasmBinaryReader::BulkMemoryNode(WasmOp op)
+{
+    // memory.copy and table.copy encode a destination and a source index, memory.fill only a destination.
+    // Only one memory and one table are supported, so the indices are reserved values that must be 0
+    const uint32 reservedCount = op == wbMemoryFill ? 1 : 2;
+    CheckBytesLeft(reservedCount);
+    for (uint32 i = 0; i < reservedCount; ++i)
+    {
+        uint8 reserved = ReadConst<uint8>();
+        if (reserved != 0)
+        {
+            ThrowDecodingError(op == wbTableCopy
+                ? _u("table.copy reserved value must be 0")
+                : _u("memory index reserved value must be 0")
+            );
+        }
+    }
+    m_funcState.count += reservedCount;
+
+    if (op == wbTableCopy && !m_module->HasTable() && !m_module->HasTableImport())
+    {
+        ThrowDecodingError(_u("Found table.copy operator, but no table"));
+    }
+}
+
 // Locals/Globals
 void WasmBinaryReader::VarNode()
 {
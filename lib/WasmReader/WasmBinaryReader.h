@@ -81,6 +81,7 @@ namespace Wasm
         void BrNode();
         void BrTableNode();
         void MemNode();
+        void BulkMemoryNode(WasmOp op);
         void LaneNode();
         void ShuffleNode();
         void VarNode();
@@ -473,9 +473,24 @@ void WasmBytecodeGenerator::ValidateFunction(Js::ScriptContext* scriptContext, W
     GenerateFunctionBytecode(scriptContext, readerinfo, true);
 }
 
-WasmBytecodeGenerator::WasmBytecodeGenerator(Js::ScriptContext* scriptContext, WasmReaderInfo* readerInfo, bool validateOnly) :
+void WasmBytecodeGenerator::ValidateFunctionInBackground(Js::ScriptContext* scriptContext, WasmReaderInfo* readerinfo, PageAllocator* pageAllocator, WasmReaderBase* reader, size_t stackLimit)
+{
+    Assert(pageAllocator && reader && stackLimit != 0);
+    Assert(readerinfo->m_funcInfo->AreLocalsRead());
+    WasmBytecodeGenerator generator(scriptContext, readerinfo, true, pageAllocator, reader);
+    generator.m_backgroundStackLimit = stackLimit;
+    generator.GenerateFunction();
+    if (!reader->IsCurrentFunctionCompleted())
+    {
+        throw WasmCompilationException(_u("Invalid function format"));
+    }
+}
+
+WasmBytecodeGenerator::WasmBytecodeGenerator(Js::ScriptContext* scriptContext, WasmReaderInfo* readerInfo, bool validateOnly, PageAllocator* pageAllocator /*= nullptr*/, WasmReaderBase* reader /*= nullptr*/) :
     m_scriptContext(scriptContext),
-    m_alloc(_u("WasmBytecodeGen"), scriptContext->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory),
+    m_alloc(_u("WasmBytecodeGen"), pageAllocator ? pageAllocator : scriptContext->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory),
+    m_reader(reader),
+    m_backgroundStackLimit(0),
     m_evalStack(&m_alloc),
     mTypedRegisterAllocator(&m_alloc, AllocateRegisterSpace, Simd::IsEnabled() ? 0 : 1 << WAsmJs::SIMD),
     m_blockInfos(&m_alloc),
@@ -551,6 +566,11 @@ void WasmBytecodeGenerator::GenerateFunction()
     m_writer->End();
     GetReader()->FunctionEnd();
     autoCleanupGeneratorState.Complete();
+    if (IsValidatingInBackground())
+    {
+        // Nothing gets committed to the function body until its bytecode is generated on the main thread
+        return;
+    }
     // Make sure we don't have any unforeseen exceptions as we finalize the body
     AutoDisableInterrupt autoDisableInterrupt(m_scriptContext->GetThreadContext(), true);
 
@@ -581,7 +601,10 @@ void WasmBytecodeGenerator::EnregisterLocals()
     uint32 nLocals = m_funcInfo->GetLocalCount();
     m_locals = AnewArray(&m_alloc, WasmLocal, nLocals);
 
-    m_funcInfo->GetBody()->SetFirstTmpReg(nLocals);
+    if (!IsValidatingInBackground())
+    {
+        m_funcInfo->GetBody()->SetFirstTmpReg(nLocals);
+    }
     for (uint32 i = 0; i < nLocals; ++i)
     {
         WasmTypes::WasmType type = m_funcInfo->GetLocal(i);
@@ -764,6 +787,11 @@ void WasmBytecodeGenerator::EmitExpr(WasmOp op)
         info = EmitGrowMemory();
         break;
     }
+    case wbMemoryCopy:
+    case wbMemoryFill:
+    case wbTableCopy:
+        info = EmitBulkMemoryExpr(op);
+        break;
     case wbUnreachable:
         m_writer->EmptyAsm(Js::OpCodeAsmJs::Unreachable_Void);
         SetUnreachableState(true);
@@ -988,8 +1016,20 @@ WasmConstLitNode WasmBytecodeGenerator::GetZeroCnst()
     return cnst;
 }
 
+_NOINLINE // _AddressOfReturnAddress must be this frame's
 void WasmBytecodeGenerator::EnsureStackAvailable()
 {
+    if (IsValidatingInBackground())
+    {
+        // Same check as ThreadContext::IsStackAvailable, against the job thread's own stack. Deeply nested
+        // bodies give up here, and the main thread validates whatever failed in the background again.
+        size_t sp = (size_t)_AddressOfReturnAddress();
+        if (sp <= m_backgroundStackLimit || sp - m_backgroundStackLimit <= Js::Constants::MinStackCompile)
+        {
+            throw WasmCompilationException(_u("Maximum supported nested blocks reached"));
+        }
+        return;
+    }
     if (!ThreadContext::IsCurrentStackAvailable(Js::Constants::MinStackCompile))
     {
         throw WasmCompilationException(_u("Maximum supported nested blocks reached"));
@@ -1417,6 +1457,41 @@ EmitInfo WasmBytecodeGenerator::EmitGrowMemory()
     return info;
 }
 
+EmitInfo WasmBytecodeGenerator::EmitBulkMemoryExpr(WasmOp wasmOp)
+{
+    // memory.copy: (dst, src, count), memory.fill: (dst, value, count), table.copy: (dst, src, count)
+    EmitInfo countInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory count"));
+    EmitInfo srcInfo = PopEvalStack(WasmTypes::I32, wasmOp == wbMemoryFill ? _u("Invalid type for memory.fill value") : _u("Invalid type for bulk memory source"));
+    EmitInfo dstInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory destination"));
+
+    switch (wasmOp)
+    {
+    case wbMemoryCopy:
+        SetUsesMemory(0);
+        m_writer->AsmReg3(Js::OpCodeAsmJs::MemoryCopy, dstInfo.location, srcInfo.location, countInfo.location);
+        break;
+    case wbMemoryFill:
+        SetUsesMemory(0);
+        m_writer->AsmReg3(Js::OpCodeAsmJs::MemoryFill, dstInfo.location, srcInfo.location, countInfo.location);
+        break;
+    case wbTableCopy:
+    {
+        Js::RegSlot tableReg = GetRegisterSpace(WasmTypes::Ptr)->AcquireTmpRegister();
+        m_writer->AsmSlot(Js::OpCodeAsmJs::LdSlotArr, tableReg, Js::AsmJsFunctionMemory::ModuleEnvRegister, m_module->GetTableEnvironmentOffset());
+        m_writer->AsmReg4(Js::OpCodeAsmJs::TableCopy, tableReg, dstInfo.location, srcInfo.location, countInfo.location);
+        GetRegisterSpace(WasmTypes::Ptr)->ReleaseTmpRegister(tableReg);
+        break;
+    }
+    default:
+        Assume(UNREACHED);
+    }
+
+    ReleaseLocation(&countInfo);
+    ReleaseLocation(&srcInfo);
+    ReleaseLocation(&dstInfo);
+    return EmitInfo();
+}
+
 EmitInfo WasmBytecodeGenerator::EmitDrop()
 {
     EmitInfo info = PopValuePolymorphic();
@@ -2043,11 +2118,18 @@ void WasmBytecodeGenerator::SetUsesMemory(uint32 memoryIndex)
     {
         throw WasmCompilationException(_u("unknown memory"));
     }
-    GetFunctionBody()->GetAsmJsFunctionInfo()->SetUsesHeapBuffer(true);
+    if (!IsValidatingInBackground())
+    {
+        GetFunctionBody()->GetAsmJsFunctionInfo()->SetUsesHeapBuffer(true);
+    }
 }
 
 Wasm::WasmReaderBase* WasmBytecodeGenerator::GetReader() const
 {
+    if (m_reader)
+    {
+        return m_reader;
+    }
     if (m_funcInfo->GetCustomReader())
     {
         return m_funcInfo->GetCustomReader();
@@ -172,9 +172,13 @@ namespace Wasm
         static const Js::RegSlot ScriptContextBufferRegister = 4;
         static const Js::RegSlot ReservedRegisterCount = 5;
 
-        WasmBytecodeGenerator(Js::ScriptContext* scriptContext, WasmReaderInfo* readerinfo, bool validateOnly);
+        WasmBytecodeGenerator(Js::ScriptContext* scriptContext, WasmReaderInfo* readerinfo, bool validateOnly, PageAllocator* pageAllocator = nullptr, WasmReaderBase* reader = nullptr);
         static void GenerateFunctionBytecode(Js::ScriptContext* scriptContext, WasmReaderInfo* readerinfo, bool validateOnly = false);
         static void ValidateFunction(Js::ScriptContext* scriptContext, WasmReaderInfo* readerinfo);
+        // Validates the body without touching the FunctionBody or the module's reader, so it can run on a job thread.
+        // The function's local declarations must already have been read on the main thread. stackLimit is the
+        // calling thread's StackProber limit, since job threads have no ThreadContext to probe the stack with.
+        static void ValidateFunctionInBackground(Js::ScriptContext* scriptContext, WasmReaderInfo* readerinfo, PageAllocator* pageAllocator, WasmReaderBase* reader, size_t stackLimit);
 
     private:
         void GenerateFunction();
@@ -192,6 +196,7 @@ namespace Wasm
         void EmitBrTable();
         EmitInfo EmitDrop();
         EmitInfo EmitGrowMemory();
+        EmitInfo EmitBulkMemoryExpr(WasmOp wasmOp);
         EmitInfo EmitGetLocal();
         EmitInfo EmitGetGlobal();
         EmitInfo EmitSetGlobal();
@@ -256,6 +261,7 @@ namespace Wasm
 
         Js::ProfileId GetNextProfileId();
         bool IsValidating() const { return m_originalWriter == m_emptyWriter; }
+        bool IsValidatingInBackground() const { return m_reader != nullptr; }
 
         ArenaAllocator m_alloc;
 
@@ -264,6 +270,8 @@ namespace Wasm
 
         WasmFunctionInfo* m_funcInfo;
         Js::WebAssemblyModule* m_module;
+        WasmReaderBase* m_reader;
+        size_t m_backgroundStackLimit;
 
         uint32 m_maxArgOutDepth;
 
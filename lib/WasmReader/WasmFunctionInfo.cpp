@@ -18,6 +18,7 @@ WasmFunctionInfo::WasmFunctionInfo(ArenaAllocator* alloc, WasmSignature* signatu
     m_customReader(nullptr),
     m_nameLength(0),
     m_number(number),
+    m_localsRead(false),
     m_locals(alloc, signature->GetParamCount())
 #if DBG_DUMP
     , importedFunctionReference(nullptr)
@@ -15,6 +15,7 @@ namespace Wasm
     {
         friend class WasmBinaryReader;
         FunctionBodyReaderInfo(uint32 size = 0, size_t startOffset = 0): size(size), startOffset(startOffset) {}
+        uint32 GetSize() const { return size; }
     private:
         Field(uint32) size = 0;
         Field(size_t) startOffset = 0;
@@ -32,6 +33,10 @@ namespace Wasm
         uint32 GetLocalCount() const;
         Js::ArgSlot GetParamCount() const;
 
+        // The local declarations are decoded again every time the body is read, but only recorded the first time
+        bool AreLocalsRead() const { return m_localsRead; }
+        void SetLocalsRead() { m_localsRead = true; }
+
         void SetName(const char16* name, uint32 nameLength) { m_name = name; m_nameLength = nameLength; }
         const char16* GetName() const { return m_name; }
         uint32 GetNameLength() const { return m_nameLength; }
@@ -72,6 +77,7 @@ namespace Wasm
         Field(const char16*) m_name;
         Field(uint32) m_nameLength;
         Field(uint32) m_number;
+        Field(bool) m_localsRead;
         Field(FunctionBodyReaderInfo) m_readerInfo;
     };
 } // namespace Wasm
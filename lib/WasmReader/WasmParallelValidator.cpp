@@ -0,0 +1,158 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "WasmReaderPch.h"
+
+#ifdef ENABLE_WASM
+#if ENABLE_NATIVE_CODEGEN
+
+namespace Wasm
+{
+
+WasmParallelValidator::WasmParallelValidator(Js::ScriptContext* scriptContext, Js::WebAssemblyModule* module, ArenaAllocator* alloc) :
+    JsUtil::WaitableJobManager(scriptContext->GetThreadContext()->GetJobProcessor()),
+    m_scriptContext(scriptContext),
+    m_module(module),
+    m_alloc(alloc),
+    m_validated(nullptr)
+{
+    Processor()->AddManager(this);
+}
+
+WasmParallelValidator::~WasmParallelValidator()
+{
+    Processor()->RemoveManager(this);
+}
+
+/* static */
+bool WasmParallelValidator::IsEnabled(Js::ScriptContext* scriptContext)
+{
+    if (!CONFIG_FLAG(WasmValidateUpfront) || !scriptContext->GetThreadContext()->GetJobProcessor()->ProcessesInBackground())
+    {
+        return false;
+    }
+#ifdef PROFILE_EXEC
+    // The profiler isn't thread safe
+    if (Js::Configuration::Global.flags.IsEnabled(Js::ProfileFlag))
+    {
+        return false;
+    }
+#endif
+    return true;
+}
+
+void WasmParallelValidator::ValidateDeferredFunctions()
+{
+    const uint32 functionCount = m_module->GetWasmFunctionCount();
+    m_validated = AnewArrayZ(m_alloc, bool, functionCount);
+
+    uint32 startIndex = 0;
+    uint32 bodySize = 0;
+    for (uint32 i = 0; i < functionCount; ++i)
+    {
+        WasmFunctionInfo* funcInfo = m_module->GetWasmFunctionInfo(i);
+        // Custom readers (used by the import thunks) are tiny and not thread safe, leave them to the main thread
+        if (funcInfo->GetCustomReader() || PHASE_OFF(Js::WasmDeferredPhase, funcInfo->GetBody()))
+        {
+            AddJob(startIndex, i);
+            startIndex = i + 1;
+            bodySize = 0;
+            continue;
+        }
+
+        // The local declarations are recorded in the module's arena, so they have to be read here.
+        // Stop at the first function they are invalid in, it is the one to report unless an earlier one fails.
+        if (!ReadLocals(i))
+        {
+            AddJob(startIndex, i);
+            startIndex = functionCount;
+            break;
+        }
+
+        bodySize += funcInfo->GetReaderInfo().GetSize();
+        if (bodySize >= JobBodySize)
+        {
+            AddJob(startIndex, i + 1);
+            startIndex = i + 1;
+            bodySize = 0;
+        }
+    }
+    AddJob(startIndex, functionCount);
+
+    Processor()->PrioritizeManagerAndWait(this, INFINITE);
+}
+
+bool WasmParallelValidator::ReadLocals(uint32 index)
+{
+    WasmBinaryReader* reader = m_module->GetReader();
+    try
+    {
+        reader->SeekToFunctionBody(m_module->GetWasmFunctionInfo(index));
+        reader->FunctionEnd();
+    }
+    catch (WasmCompilationException& ex)
+    {
+        reader->FunctionEnd();
+        SysFreeString(ex.ReleaseErrorMessage());
+        return false;
+    }
+    return true;
+}
+
+void WasmParallelValidator::AddJob(uint32 startIndex, uint32 endIndex)
+{
+    if (startIndex >= endIndex)
+    {
+        return;
+    }
+
+    ValidationJob* job = Anew(m_alloc, ValidationJob, this, startIndex, endIndex);
+    AutoOptionalCriticalSection autoLock(Processor()->GetCriticalSection());
+    Processor()->AddJob(job, false);
+}
+
+bool WasmParallelValidator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData)
+{
+    ValidationJob* validationJob = static_cast<ValidationJob*>(job);
+
+    // No thread data means the job is being processed in the foreground
+    PageAllocator* pageAllocator = threadData ? threadData->GetPageAllocator() : m_scriptContext->GetThreadContext()->GetPageAllocator();
+    ArenaAllocator alloc(_u("WasmValidation"), pageAllocator, Js::Throw::OutOfMemory);
+    WasmBinaryReader* reader = Anew(&alloc, WasmBinaryReader, &alloc, m_module, m_module->GetBinaryBuffer(), m_module->GetBinaryBufferLength());
+
+    // Job threads are created with the default stack size, which may be smaller than the main thread's
+    StackProber stackProber;
+    stackProber.Initialize();
+
+    for (uint32 i = validationJob->startIndex; i < validationJob->endIndex; ++i)
+    {
+        Js::FunctionBody* body = m_module->GetWasmFunctionInfo(i)->GetBody();
+        WasmReaderInfo* readerInfo = body->GetAsmJsFunctionInfo()->GetWasmReaderInfo();
+        try
+        {
+            WasmBytecodeGenerator::ValidateFunctionInBackground(m_scriptContext, readerInfo, pageAllocator, reader, stackProber.GetScriptStackLimit());
+            m_validated[i] = true;
+        }
+        catch (WasmCompilationException& ex)
+        {
+            // The main thread validates this one again to report the error. Later functions are
+            // still worth validating, the error is only reported if nothing before it fails.
+            reader->FunctionEnd();
+            SysFreeString(ex.ReleaseErrorMessage());
+        }
+    }
+    return true;
+}
+
+void WasmParallelValidator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
+{
+    // The jobs live in the caller's arena. A failed job (out of memory) leaves its functions
+    // unmarked, and the main thread validates them.
+}
+
+} // namespace Wasm
+
+#endif
+#endif // ENABLE_WASM
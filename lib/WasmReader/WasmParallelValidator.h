@@ -0,0 +1,53 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+#ifdef ENABLE_WASM
+#if ENABLE_NATIVE_CODEGEN
+namespace Wasm
+{
+    // Validates the deferred function bodies of a module on the job processor's threads, so that
+    // WebAssembly.compile reports invalid bodies up front while bytecode generation stays lazy.
+    // Each job validates a contiguous range of functions with its own reader over the module's buffer.
+    // Nothing is reported from the job threads: a function is either marked as validated, or left for
+    // the main thread to validate again in index order, which raises the usual compile error.
+    class WasmParallelValidator sealed : public JsUtil::WaitableJobManager
+    {
+    public:
+        WasmParallelValidator(Js::ScriptContext* scriptContext, Js::WebAssemblyModule* module, ArenaAllocator* alloc);
+        ~WasmParallelValidator();
+
+        static bool IsEnabled(Js::ScriptContext* scriptContext);
+
+        void ValidateDeferredFunctions();
+        bool IsValidated(uint32 index) const { return m_validated != nullptr && m_validated[index]; }
+
+        virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
+        virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
+
+    private:
+        struct ValidationJob sealed : public JsUtil::Job
+        {
+            ValidationJob(JsUtil::JobManager *const manager, uint32 startIndex, uint32 endIndex) :
+                JsUtil::Job(manager), startIndex(startIndex), endIndex(endIndex) {}
+
+            const uint32 startIndex;
+            const uint32 endIndex;
+        };
+
+        static const uint32 JobBodySize = 64 * 1024;
+
+        bool ReadLocals(uint32 index);
+        void AddJob(uint32 startIndex, uint32 endIndex);
+
+        Js::ScriptContext* m_scriptContext;
+        Js::WebAssemblyModule* m_module;
+        ArenaAllocator* m_alloc;
+        // One byte per function, the jobs write to them concurrently
+        bool* m_validated;
+    };
+} // namespace Wasm
+#endif
+#endif // ENABLE_WASM
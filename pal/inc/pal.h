@@ -3259,6 +3259,8 @@ SetErrorMode(
 #define MEM_TOP_DOWN                    0x100000
 #define MEM_WRITE_WATCH                 0x200000
 #define MEM_RESERVE_EXECUTABLE          0x40000000 // reserve memory using executable memory allocator
+#define MEM_RESERVE_HUGEPAGES           0x08000000 // PAL only: 2MB aligned reservation, advise transparent huge pages
+#define MEM_RESERVE_NUMA_LOCAL          0x04000000 // PAL only: prefer the NUMA node of the reserving thread
 
 PALIMPORT
 HANDLE
@@ -3607,7 +3609,7 @@ GlobalMemoryStatusEx(
 
 typedef struct _MEMORY_BASIC_INFORMATION {
     PVOID BaseAddress;
-    PVOID AllocationBase_PAL_Undefined;
+    PVOID AllocationBase;           // Only set for regions allocated with VirtualAlloc
     DWORD AllocationProtect;
     SIZE_T RegionSize;
     DWORD State;
@@ -5775,6 +5777,14 @@ VOID
 PALAPI
 FlushProcessWriteBuffers();
 
+typedef LONG (*PAL_HardwareExceptionFilter)(PEXCEPTION_POINTERS pointers);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_SetHardwareExceptionFilter(
+    IN PAL_HardwareExceptionFilter pFilter);
+
 typedef void (*PAL_ActivationFunction)(CONTEXT *context);
 typedef BOOL (*PAL_SafeActivationCheckFunction)(SIZE_T ip, BOOL checkingCurrentThread);
 
@@ -18,3 +18,33 @@ RaiseException(IN DWORD dwExceptionCode,
         abort();
     }
 }
+
+// Filter that the SIGSEGV handler runs before treating a fault as unhandled
+PAL_HardwareExceptionFilter g_hardwareExceptionFilter = NULL;
+
+/*++
+Function:
+    PAL_SetHardwareExceptionFilter
+
+    Register a filter that gets a chance to handle access violations raised by
+    hardware faults. If the filter returns EXCEPTION_CONTINUE_EXECUTION, execution
+    resumes with the (possibly modified) context record.
+
+    The filter is meant to be set once, at initialization. It runs inside the
+    SIGSEGV handler on the faulting thread, so it must reject faults it doesn't
+    own without taking locks or allocating.
+
+Parameters:
+    pFilter - exception filter, or NULL to remove it
+
+Return value:
+    None
+--*/
+PALIMPORT
+VOID
+PALAPI
+PAL_SetHardwareExceptionFilter(
+    IN PAL_HardwareExceptionFilter pFilter)
+{
+    g_hardwareExceptionFilter = pFilter;
+}
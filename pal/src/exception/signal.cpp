@@ -40,6 +40,7 @@ Module Name:
 #include <unistd.h>
 
 #include "pal/context.h"
+#include "signal.hpp"
 
 using namespace CorUnix;
 
@@ -290,6 +291,23 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
+        if (g_hardwareExceptionFilter != NULL && record.ExceptionCode == EXCEPTION_ACCESS_VIOLATION)
+        {
+            CONTEXT winContext;
+            CONTEXTFromNativeContext(
+                ucontext,
+                &winContext,
+                CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_FLOATING_POINT);
+            pointers.ContextRecord = &winContext;
+
+            if (g_hardwareExceptionFilter(&pointers) == EXCEPTION_CONTINUE_EXECUTION)
+            {
+                // The filter may have modified the context, e.g. to skip the faulting instruction
+                CONTEXTToNativeContext(&winContext, ucontext);
+                return;
+            }
+        }
+
         common_signal_handler(&pointers, code, ucontext);
     }
 
@@ -47,6 +47,8 @@ Function :
 --*/
 void SEHCleanupSignals();
 
+extern PAL_HardwareExceptionFilter g_hardwareExceptionFilter;
+
 #if (__GNUC__ > 3 ||                                            \
      (__GNUC__ == 3 && __GNUC_MINOR__ > 2))
 // For gcc > 3.2, sjlj exceptions semantics are no longer available
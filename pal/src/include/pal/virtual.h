@@ -36,6 +36,7 @@ typedef struct _CMI {
 
     DWORD  accessProtection;    /* Initial allocation access protection. */
     DWORD  allocationType;      /* Initial allocation type. */
+    INT    numaNode;            /* Preferred NUMA node, -1 for none. */
 
     BYTE * pAllocState;         /* Individual allocation type tracking for each */
                                 /* page in the region. */
@@ -69,7 +70,13 @@ enum VIRTUAL_CONSTANTS
     VIRTUAL_PAGE_SIZE       = 0x1000,
 #endif  // __sparc__
     VIRTUAL_PAGE_MASK       = VIRTUAL_PAGE_SIZE - 1,
-    BOUNDARY_64K    = 0xffff
+    BOUNDARY_64K    = 0xffff,
+
+    /* MEM_RESERVE_HUGEPAGES reservations are aligned to the huge page size. */
+    VIRTUAL_HUGE_PAGE_SIZE  = 0x200000,
+
+    /* Highest NUMA node count MEM_RESERVE_NUMA_LOCAL handles. */
+    VIRTUAL_MAX_NUMA_NODES  = 1024
 };
 
 /*++
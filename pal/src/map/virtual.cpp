@@ -35,6 +35,9 @@ Module Name:
 #include <string.h>
 #include <unistd.h>
 #include <limits.h>
+#if defined(__LINUX__)
+#include <sys/syscall.h>
+#endif
 
 #if HAVE_VM_ALLOCATE
 #include <mach/vm_map.h>
@@ -739,6 +742,62 @@ static DWORD VIRTUALConvertVirtualFlags( IN BYTE VirtualProtect )
     return MemAccessControl;
 }
 
+/****
+ *  VIRTUALGetPlacementNode()
+ *
+ *      Returns the NUMA node of the calling thread if the allocation asked
+ *      for MEM_RESERVE_NUMA_LOCAL and the node is known, -1 otherwise.
+ */
+static INT VIRTUALGetPlacementNode( IN DWORD flAllocationType )
+{
+#if defined(__LINUX__) && defined(SYS_getcpu) && defined(SYS_mbind)
+    unsigned int cpu, node;
+    if ( ( flAllocationType & MEM_RESERVE_NUMA_LOCAL ) != 0 &&
+         syscall( SYS_getcpu, &cpu, &node, NULL ) == 0 &&
+         node < VIRTUAL_MAX_NUMA_NODES )
+    {
+        return (INT)node;
+    }
+#endif
+    return -1;
+}
+
+/****
+ *  VIRTUALApplyPlacement()
+ *
+ *      Applies the huge page and NUMA hints of a region to a range in it.
+ *      Committing maps new pages over the range, which drops the hints given
+ *      to the mapping it replaces, so this runs after every commit as well as
+ *      after the reservation. Both hints are advisory; failures are ignored.
+ */
+static void VIRTUALApplyPlacement( IN CONST PCMI pInformation,
+                                   IN UINT_PTR startBoundary,
+                                   IN SIZE_T memSize )
+{
+#if defined(__LINUX__)
+#ifdef MADV_HUGEPAGE
+    if ( ( pInformation->allocationType & MEM_RESERVE_HUGEPAGES ) != 0 )
+    {
+        madvise( (void *)startBoundary, memSize, MADV_HUGEPAGE );
+    }
+#endif
+#if defined(SYS_mbind)
+    if ( pInformation->numaNode >= 0 )
+    {
+        const unsigned long bitsPerLong = sizeof(unsigned long) * CHAR_BIT;
+        unsigned long nodeMask[VIRTUAL_MAX_NUMA_NODES / (sizeof(unsigned long) * CHAR_BIT)] = { 0 };
+        nodeMask[pInformation->numaNode / bitsPerLong] |= 1UL << (pInformation->numaNode % bitsPerLong);
+
+        // MPOL_PREFERRED rather than MPOL_BIND, so running out of memory on the
+        // node falls back to other nodes instead of failing the page fault
+        const int mpolPreferred = 1;
+        syscall( SYS_mbind, startBoundary, memSize, mpolPreferred,
+                 nodeMask, sizeof(nodeMask) * CHAR_BIT, 0 );
+    }
+#endif
+#endif // __LINUX__
+}
+
 /****
  *  VIRTUALStoreAllocationInfo()
  *
@@ -774,6 +833,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     pNewEntry->memSize          = memSize;
     pNewEntry->allocationType   = flAllocationType;
     pNewEntry->accessProtection = flProtection;
+    pNewEntry->numaNode         = VIRTUALGetPlacementNode( flAllocationType );
 
     nBufferSize = memSize / VIRTUAL_PAGE_SIZE / CHAR_BIT;
     if ( ( memSize / VIRTUAL_PAGE_SIZE ) % CHAR_BIT != 0 )
@@ -929,6 +989,11 @@ static LPVOID VIRTUALReserveMemory(
             munmap( pRetVal, MemSize );
             pRetVal = NULL;
         }
+        else if ( ( flAllocationType & ( MEM_RESERVE_HUGEPAGES | MEM_RESERVE_NUMA_LOCAL ) ) != 0 )
+        {
+            VIRTUALApplyPlacement( VIRTUALFindRegionInformation( StartBoundary ),
+                                   StartBoundary, MemSize );
+        }
     }
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
@@ -1201,6 +1266,7 @@ static LPVOID VIRTUALCommitMemory(
 #if MMAP_DOESNOT_ALLOW_REMAP
             VIRTUALSetDirtyPages (0, runStart, runLength, pInformation);
 #endif // MMAP_DOESNOT_ALLOW_REMAP
+            VIRTUALApplyPlacement(pInformation, StartBoundary, MemSize);
 
             if (nProtect == (PROT_WRITE | PROT_READ))
             {
@@ -1633,10 +1699,12 @@ VirtualAlloc_(
     }
 
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE |
+                                 MEM_RESERVE_HUGEPAGES | MEM_RESERVE_NUMA_LOCAL ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, MEM_RESERVE_HUGEPAGES \
+               or MEM_RESERVE_NUMA_LOCAL.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -1716,7 +1784,12 @@ VirtualAlloc(
 
     if (reserve || commit)
     {
-        char *address = (char*) VirtualAlloc_(nullptr, dwSize, MEM_RESERVE, flProtect);
+        // Placement hints belong to the reservation
+        DWORD reserveType = MEM_RESERVE | (flAllocationType & (MEM_RESERVE_HUGEPAGES | MEM_RESERVE_NUMA_LOCAL));
+        SIZE_T alignment = (flAllocationType & MEM_RESERVE_HUGEPAGES) ? VIRTUAL_HUGE_PAGE_SIZE : KB64;
+        flAllocationType &= ~(MEM_RESERVE_HUGEPAGES | MEM_RESERVE_NUMA_LOCAL);
+
+        char *address = (char*) VirtualAlloc_(nullptr, dwSize, reserveType, flProtect);
         if (!address) return nullptr;
 
         if (reserve)
@@ -1724,28 +1797,28 @@ VirtualAlloc(
             flAllocationType &= ~MEM_RESERVE;
         }
 
-        SIZE_T diff = ((ULONG_PTR)address % KB64);
+        SIZE_T diff = ((ULONG_PTR)address % alignment);
         if ( diff != 0 )
         {
             VirtualFree(address, 0, MEM_RELEASE);
-            char *addr64 = address + (KB64 - diff);
+            char *addrAligned = address + (alignment - diff);
 
             // try reserving from the same address space
-            address = (char*) VirtualAlloc_(addr64, dwSize, MEM_RESERVE, flProtect);
+            address = (char*) VirtualAlloc_(addrAligned, dwSize, reserveType, flProtect);
 
             if (!address)
             {   // looks like ``pushed new address + dwSize`` is not available
                 // try on a bigger surface
-                address = (char*) VirtualAlloc_(nullptr, dwSize + KB64, MEM_RESERVE, flProtect);
+                address = (char*) VirtualAlloc_(nullptr, dwSize + alignment, MEM_RESERVE, flProtect);
                 if (!address) return nullptr;
 
-                diff = ((ULONG_PTR)address % KB64);
-                addr64 = address + (KB64 - diff);
+                diff = ((ULONG_PTR)address % alignment);
+                addrAligned = address + (alignment - diff);
 
                 CPalThread *pthrCurrent = InternalGetCurrentThread();
                 InternalEnterCriticalSection(pthrCurrent, &virtual_realloc);
                 VirtualFree(address, 0, MEM_RELEASE);
-                address = (char*) VirtualAlloc_(addr64, dwSize, MEM_RESERVE, flProtect);
+                address = (char*) VirtualAlloc_(addrAligned, dwSize, reserveType, flProtect);
                 InternalLeaveCriticalSection(pthrCurrent, &virtual_realloc);
 
                 if (!address) return nullptr;
@@ -2375,6 +2448,7 @@ VirtualQuery(
 
         /* Fill the structure.*/
         lpBuffer->AllocationProtect = pEntry->accessProtection;
+        lpBuffer->AllocationBase = (LPVOID)pEntry->startBoundary;
         lpBuffer->BaseAddress = (LPVOID)StartBoundary;
 
         lpBuffer->Protect = AllocationType == MEM_COMMIT ?
@@ -2383,7 +2457,7 @@ VirtualQuery(
         lpBuffer->RegionSize = RegionSize;
         lpBuffer->State =
             ( AllocationType == MEM_COMMIT ? MEM_COMMIT : MEM_RESERVE );
-        WARN( "Ignoring lpBuffer->Type. \n" );
+        lpBuffer->Type = MEM_PRIVATE;
     }
 
 ExitVirtualQuery:
@@ -0,0 +1,130 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Out of bounds heap accesses of every view type. Loads return 0 or NaN and stores are dropped. On x64 the
+// jitted accesses have no bounds checks and are recovered through the hardware exception filter, so the
+// results must match the interpreter's.
+
+function AsmModule(stdlib, foreign, heap) {
+    "use asm";
+
+    var HEAP8 = new stdlib.Int8Array(heap);
+    var HEAPU16 = new stdlib.Uint16Array(heap);
+    var HEAP32 = new stdlib.Int32Array(heap);
+    var HEAPF32 = new stdlib.Float32Array(heap);
+    var HEAPF64 = new stdlib.Float64Array(heap);
+
+    function load8(i) { i = i|0; return HEAP8[i >> 0]|0; }
+    function loadU16(i) { i = i|0; return HEAPU16[i >> 1]|0; }
+    function load32(i) { i = i|0; return HEAP32[i >> 2]|0; }
+    function loadF32(i) { i = i|0; return +HEAPF32[i >> 2]; }
+    function loadF64(i) { i = i|0; return +HEAPF64[i >> 3]; }
+
+    // The destination register holds a live value before the load, which the recovery must overwrite
+    function load32Add(i, x) { i = i|0; x = x|0; x = (x + (HEAP32[i >> 2]|0))|0; return x|0; }
+    function loadF64Add(i, x) { i = i|0; x = +x; x = x + +HEAPF64[i >> 3]; return +x; }
+
+    function store8(i, v) { i = i|0; v = v|0; HEAP8[i >> 0] = v; }
+    function storeU16(i, v) { i = i|0; v = v|0; HEAPU16[i >> 1] = v; }
+    function store32(i, v) { i = i|0; v = v|0; HEAP32[i >> 2] = v; }
+    function storeF32(i, v) { i = i|0; v = +v; HEAPF32[i >> 2] = v; }
+    function storeF64(i, v) { i = i|0; v = +v; HEAPF64[i >> 3] = v; }
+
+    // Sums the int32s from start up to end, so that the out of bounds loads happen in a jitted loop
+    function sum32(start, end) {
+        start = start|0;
+        end = end|0;
+        var s = 0;
+        for (; (start|0) < (end|0); start = (start + 4)|0) {
+            s = (s + (HEAP32[start >> 2]|0))|0;
+        }
+        return s|0;
+    }
+
+    return {
+        load8: load8, loadU16: loadU16, load32: load32, loadF32: loadF32, loadF64: loadF64,
+        load32Add: load32Add, loadF64Add: loadF64Add,
+        store8: store8, storeU16: storeU16, store32: store32, storeF32: storeF32, storeF64: storeF64,
+        sum32: sum32
+    };
+}
+
+var kHeapSize = 0x10000;
+var buffer = new ArrayBuffer(kHeapSize);
+var bytes = new Uint8Array(buffer);
+var asm = AsmModule(this, {}, buffer);
+
+var passed = true;
+function check(expected, actual, msg) {
+    if (!Object.is(expected, actual)) {
+        passed = false;
+        print("FAILED. " + msg + ": expected " + expected + ", received " + actual);
+    }
+}
+
+var loads = [
+    { name: "load8",   size: 1, value: 0x7f,   outOfBounds: 0 },
+    { name: "loadU16", size: 2, value: 0xffff, outOfBounds: 0 },
+    { name: "load32",  size: 4, value: -2,     outOfBounds: 0 },
+    { name: "loadF32", size: 4, value: 1.5,    outOfBounds: NaN },
+    { name: "loadF64", size: 8, value: -2.25,  outOfBounds: NaN },
+];
+var stores = [
+    { name: "store8",   load: "load8",   size: 1, value: 0x7f },
+    { name: "storeU16", load: "loadU16", size: 2, value: 0xffff },
+    { name: "store32",  load: "load32",  size: 4, value: -2 },
+    { name: "storeF32", load: "loadF32", size: 4, value: 1.5 },
+    { name: "storeF64", load: "loadF64", size: 8, value: -2.25 },
+];
+
+// Indices past the end, including negative ones that are far out of bounds as unsigned offsets
+var outOfBoundsIndices = [kHeapSize, kHeapSize + 8, 0x7ffffff8, -8, -0x80000000];
+
+function testLoadsAndStores() {
+    for (var i = 0; i < stores.length; i++) {
+        var store = stores[i];
+        var last = kHeapSize - store.size;
+        asm[store.name](last, store.value);
+        check(store.value, asm[store.load](last), store.name + " at the last index");
+
+        for (var j = 0; j < outOfBoundsIndices.length; j++) {
+            var index = outOfBoundsIndices[j];
+            asm[store.name](index, 1);
+            check(store.value, asm[store.load](last), store.name + " at " + index + " changed the heap");
+        }
+        bytes.fill(0, last);
+    }
+
+    for (var i = 0; i < loads.length; i++) {
+        var load = loads[i];
+        for (var j = 0; j < outOfBoundsIndices.length; j++) {
+            var index = outOfBoundsIndices[j];
+            check(load.outOfBounds, asm[load.name](index), load.name + " at " + index);
+        }
+    }
+
+    bytes.fill(0xff);
+    check(7, asm.load32Add(kHeapSize, 7), "load32Add out of bounds");
+    check(6, asm.load32Add(0, 7), "load32Add in bounds");
+    check(NaN, asm.loadF64Add(kHeapSize, 1.5), "loadF64Add out of bounds");
+    bytes.fill(0);
+    check(1.5, asm.loadF64Add(0, 1.5), "loadF64Add in bounds");
+
+    var int32 = new Int32Array(buffer);
+    int32[int32.length - 1] = 5;
+    int32[int32.length - 2] = 6;
+    check(11, asm.sum32(kHeapSize - 8, kHeapSize), "sum32 of the last int32s");
+    check(11, asm.sum32(kHeapSize - 8, kHeapSize + 64), "sum32 past the end");
+    bytes.fill(0);
+}
+
+// Run enough times for the functions to be jitted
+for (var k = 0; k < 20; k++) {
+    testLoadsAndStores();
+}
+
+if (passed) {
+    print("PASSED");
+}
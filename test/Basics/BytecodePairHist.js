@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -nonative -BytecodePairHist. Covers the interpreter handlers that jump straight to the next
+// opcode's handler (loops, calls, exceptions, generators, switches, closures) while every executed pair is
+// counted. The histogram is printed when the script context closes, so the output isn't compared against a
+// baseline; a wrong result throws instead, failing the test through the exit code.
+
+function check(expected, actual, msg) {
+    if (expected !== actual) {
+        throw new Error(msg + ": expected " + expected + ", received " + actual);
+    }
+}
+
+function loop(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += i & 1 ? i : -i;
+    }
+    return sum;
+}
+
+function classify(x) {
+    switch (typeof x) {
+        case "number": return x > 0 ? "positive" : "nonpositive";
+        case "string": return "string:" + x.length;
+        case "object": return x === null ? "null" : "object";
+        default: return "other";
+    }
+}
+
+function thrower(n) {
+    try {
+        if (n % 3 === 0) {
+            throw new RangeError("n");
+        }
+        return n;
+    } catch (e) {
+        return e instanceof RangeError ? -1 : -2;
+    } finally {
+        n++;
+    }
+}
+
+function* counter(n) {
+    for (var i = 0; i < n; i++) {
+        yield i * i;
+    }
+}
+
+function makeAdder(x) {
+    return function (y) { return x + y; };
+}
+
+function run() {
+    check(500, loop(1000), "loop");
+    check("positive,nonpositive,string:3,null,object,other",
+        [1, -1, "abc", null, {}, undefined].map(classify).join(), "switch");
+
+    var caught = 0;
+    for (var i = 0; i < 30; i++) {
+        if (thrower(i) === -1) {
+            caught++;
+        }
+    }
+    check(10, caught, "try/catch/finally");
+
+    var squares = 0;
+    for (var s of counter(10)) {
+        squares += s;
+    }
+    check(285, squares, "generator");
+
+    var add5 = makeAdder(5);
+    var total = 0;
+    for (var j = 0; j < 100; j++) {
+        total = add5(total) - 4;
+    }
+    check(100, total, "closure");
+
+    var o = { a: 1, get b() { return this.a + 1; } };
+    var keys = "";
+    for (var k in o) {
+        keys += k + o[k];
+    }
+    check("a1b2", keys, "for in");
+}
+
+for (var iteration = 0; iteration < 10; iteration++) {
+    run();
+}
@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -BaselineJitMaxByteCodeCount, so that the small loop-free functions below go from the
+// auto-profiling interpreter straight to simple JIT, while the loops in the driver still go through the
+// profiling interpreter.
+
+function add(a, b) {
+  return a + b;
+}
+
+function getX(o) {
+  return o.x;
+}
+
+function setY(o, v) {
+  o.y = v;
+  return o;
+}
+
+function choose(c, a, b) {
+  return c ? add(a, b) : getX({ x: a - b });
+}
+
+function concat(s, n) {
+  return s + n;
+}
+
+var sum = 0;
+var str = "";
+var objects = [{ x: 1 }, { x: 2, y: 0 }, { y: 1, x: 3 }];
+for (var i = 0; i < 1000; i++) {
+  sum += add(i, 1);
+  sum += getX(objects[i % objects.length]);
+  sum += setY(objects[i % objects.length], i).y;
+  sum += choose(i & 1, i, 2);
+  if (i % 100 === 0) {
+    str = concat(str, i);
+  }
+}
+
+// Change the types after the functions have been jitted
+sum += add(0.5, 0.25) + add(2147483647, 1);
+var s = add("a", 1) + getX({ x: "b" }) + concat(1, 2);
+
+if (sum !== 1501499.75 + 2147483648 || s !== "a1b3" || str !== "0100200300400500600700800900") {
+  WScript.Echo("FAIL: " + sum + " " + s + " " + str);
+} else {
+  WScript.Echo("PASS");
+}
@@ -0,0 +1,79 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -ParallelParseThreshold:1, so that the function bodies of this script and of the
+// eval'd sources below are parsed on the background job threads.
+
+var TEST = function(a, b) {
+  if (a !== b) {
+    throw new Error(a + " !== " + b);
+  }
+}
+
+var shared = 1;
+let sharedLet = 2;
+
+function usesGlobals() {
+  return shared + sharedLet;
+}
+
+function closures(x) {
+  let inner = function (y) { return x + y + shared; };
+  function nested(z) {
+    return inner(z) * 2;
+  }
+  return nested(x);
+}
+
+function blocks(n) {
+  var result = [];
+  for (let i = 0; i < n; i++) {
+    result.push(function () { return i; });
+  }
+  { let i = 100; result.push(() => i); }
+  return result.map(f => f()).join();
+}
+
+function regex(s) {
+  return /(\d+)-(\d+)/.exec(s)[2] + /x/g.test(s);
+}
+
+class Point {
+  constructor(x, y) { this.x = x; this.y = y; }
+  get length() { return Math.sqrt(this.x * this.x + this.y * this.y); }
+}
+
+function* generator() {
+  yield usesGlobals();
+  yield closures(1);
+}
+
+TEST(3, usesGlobals());
+TEST(10, closures(2));
+TEST("0,1,2,100", blocks(3));
+TEST("34false", regex("12-34"));
+TEST(5, new Point(3, 4).length);
+TEST("3,6", Array.from(generator()).join());
+
+// Many functions in one source
+var source = "";
+for (var i = 0; i < 200; i++) {
+  source += "function f" + i + "(a) { var b = a + " + i + "; return function () { return b; }; }\n";
+}
+source += "f0(1)() + f199(1)();";
+TEST(201, eval(source));
+
+// A syntax error in a function body still reports the first error in the source
+var invalid = "function ok() { return 1; }\nfunction bad() { return 1 +; }\nfunction alsoBad() { var; }\n";
+var error;
+try {
+  eval(invalid);
+} catch (e) {
+  error = e;
+}
+TEST(true, error instanceof SyntaxError);
+TEST("Syntax error", error.message);
+
+console.log("PASS");
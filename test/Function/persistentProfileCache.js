@@ -0,0 +1,94 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -PersistentProfileCacheDir and -force:deferparse. Each load of the same source gets a new source
+// context, so the first load that finds no usable cache file records the extents of the deferred global
+// functions and later loads seek past their bodies. Every load must behave the same as a source that never
+// went through the cache. Debug builds also assert that the function ids assigned when a skipped function
+// is parsed on its first call match the ids the skipped scan would have assigned.
+//
+// With -ForceCorruptPersistentProfileCache the cache files are written corrupt, so every load must reject
+// them and parse the whole source.
+
+var source = [
+    "var counter = 1;",
+    "function add(a, b) { return a + b; }",
+    "function withNested(x) {",
+    "    function inner(y) { return y * 2; }",
+    "    var arrow = (z) => inner(z) + x;",
+    "    return arrow(x) + (function () { return counter; })();",
+    "}",
+    "function strict() { 'use strict'; return this === undefined; }",
+    "function multiUnit() { return 'é中'.length; /* é中 */ }",
+    "function callsEval(s) { return eval(s); }",
+    "function withStmt(o) { with (o) { return p; } }",
+    "function thrower() {",
+    "    return new Error('thrown').stack;",
+    "}",
+    "var expr = function named() { return typeof named; };",
+    "function nestedThrower() { function deep() { return new Error('deep').stack; } return deep(); }",
+    "function last() {",
+    "    return [add(1, 2), withNested(3), strict(), multiUnit(), callsEval('counter + 1'), withStmt({ p: 7 })].join();",
+    "}",
+].join("\n");
+
+var syntaxErrorSource = [
+    "function valid() { return 1; }",
+    "function invalid() {",
+    "    return 1 +;",
+    "}",
+].join("\n");
+
+var passed = true;
+function check(expected, actual, msg) {
+    if (expected !== actual) {
+        passed = false;
+        print("FAILED. " + msg + ":\nexpected\n" + expected + "\nreceived\n" + actual);
+    }
+}
+
+// The line and column of the frames in the source, since the URLs differ between eval code and loaded scripts
+function positions(stack, frameCount) {
+    return stack.split("\n").slice(1, 1 + frameCount).map(function (frame) {
+        var match = /:(\d+:\d+)\)?$/.exec(frame);
+        return match ? match[1] : frame;
+    }).join();
+}
+
+function describe(global) {
+    return [
+        global.last(),
+        global.expr(),
+        positions(global.thrower(), 1),
+        positions(global.nestedThrower(), 2),
+        global.withNested.toString(),
+        global.multiUnit.toString(),
+        global.last.toString(),
+    ].join("\n");
+}
+
+function describeSyntaxError(load) {
+    try {
+        load();
+    } catch (e) {
+        return e.name + ": " + e.message;
+    }
+    return "no error";
+}
+
+// Global eval doesn't go through the cache
+var realm = WScript.LoadScript("var unused;", "samethread");
+realm.eval(source);
+var reference = describe(realm);
+var referenceSyntaxError = describeSyntaxError(function () { realm.eval(syntaxErrorSource); });
+
+for (var i = 0; i < 3; i++) {
+    check(reference, describe(WScript.LoadScript(source, "samethread")), "load " + i);
+    check(referenceSyntaxError, describeSyntaxError(function () { WScript.LoadScript(syntaxErrorSource); }), "syntax error load " + i);
+}
+
+if (passed) {
+    print("PASSED");
+}
@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -PersistentProfileCacheDir, -force:deferparse and the ch flag -ReuseSourceContext, so that every
+// source loaded below runs under the same source context. The cached extents of the deferred global functions
+// must be those of the source being parsed, not those of the first source loaded under the context. The
+// second source has a '}' wherever a function body of the first one ends, so extents that were used for the
+// wrong source would still land on a '}' and silently cut its functions short.
+
+var first = [
+    "function f(x) { return x + 1; }",
+    "function g() { return 'first'; }",
+    "var h = function () { return f(1) + g(); };",
+].join("\n");
+
+// Pads each function of the first source with an inner block that closes where the function closed
+function padded(text, body) {
+    var close = text.indexOf("}");
+    var open = text.indexOf("{") + 2;
+    return text.slice(0, open) + "{" + " ".repeat(close - open - 1) + "}" + body;
+}
+
+var lines = first.split("\n");
+var second = [
+    padded(lines[0], " return x + 2; }"),
+    padded(lines[1], " return 'second'; }"),
+    lines[2],
+].join("\n");
+
+var passed = true;
+function check(expected, actual, msg) {
+    if (expected !== actual) {
+        passed = false;
+        print("FAILED. " + msg + ":\nexpected\n" + expected + "\nreceived\n" + actual);
+    }
+}
+
+// The premise of the test: the first source's offsets land on a '}' in the second one
+check(first.indexOf("}"), second.indexOf("}", first.indexOf("{") + 2), "padding");
+
+function describe(global) {
+    return [global.f(1), global.g(), global.h(), global.f.toString(), global.g.toString()].join("\n");
+}
+
+// Global eval doesn't go through the cache
+function reference(source) {
+    var realm = WScript.LoadScript("var unused;", "samethread");
+    realm.eval(source);
+    return describe(realm);
+}
+
+var expected = { first: reference(first), second: reference(second) };
+var order = ["first", "second", "first", "second", "second", "first"];
+for (var i = 0; i < order.length; i++) {
+    var source = order[i] === "first" ? first : second;
+    check(expected[order[i]], describe(WScript.LoadScript(source)), "load " + i + " of the " + order[i] + " source");
+}
+
+if (passed) {
+    print("PASSED");
+}
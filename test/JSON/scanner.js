@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String literals are scanned several characters at a time; put the quote, escapes and
+// control characters at every position relative to those blocks.
+
+var TEST = function(a, b) {
+  if (a !== b) {
+    throw new Error(JSON.stringify(a) + " !== " + JSON.stringify(b));
+  }
+}
+
+var plain = "abcdefghijklmnopqrstuvwxyz0123456789é中";
+for (var length = 0; length < 40; length++) {
+  var prefix = plain.substring(0, length);
+
+  TEST(prefix, JSON.parse('"' + prefix + '"'));
+  TEST(prefix + "\n" + prefix, JSON.parse('"' + prefix + '\\n' + prefix + '"'));
+  TEST(prefix + "\"", JSON.parse('"' + prefix + '\\""'));
+  TEST(prefix + "\u2028\\", JSON.parse('"' + prefix + '\\u2028\\\\"'));
+  TEST(prefix, JSON.parse('{"' + prefix + '":"' + prefix + '"}')[prefix]);
+
+  var threw = false;
+  try {
+    JSON.parse('"' + prefix + '\t' + prefix + '"');
+  } catch (e) {
+    threw = e instanceof SyntaxError;
+  }
+  TEST(true, threw);
+
+  threw = false;
+  try {
+    JSON.parse('"' + prefix);
+  } catch (e) {
+    threw = e instanceof SyntaxError;
+  }
+  TEST(true, threw);
+}
+
+// Integers take a shortcut when they are exact in a double
+TEST(0, JSON.parse("0"));
+TEST(-0, JSON.parse("-0"));
+TEST(1 / -0, 1 / JSON.parse("-0"));
+TEST(123456789012345, JSON.parse("123456789012345"));
+TEST(1234567890123456789, JSON.parse("1234567890123456789"));
+TEST(-42, JSON.parse("-42"));
+TEST(12.5, JSON.parse("12.5"));
+TEST(1e21, JSON.parse("1e21"));
+TEST(15E-1, JSON.parse("15E-1"));
+TEST(3, JSON.parse("[1,2,3]")[2]);
+TEST(7, JSON.parse('{"a" : 7 }').a);
+
+var threw = false;
+try {
+  JSON.parse("01");
+} catch (e) {
+  threw = e instanceof SyntaxError;
+}
+TEST(true, threw);
+
+console.log("PASS");
@@ -0,0 +1,59 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Queue functions and loop bodies of different heat from two script contexts to the background JIT,
+// so that queued work items get reordered while they wait.
+
+var source = [
+    "function makeFunctions(count) {",
+    "    var functions = [];",
+    "    for (var i = 0; i < count; i++) {",
+    "        functions.push(new Function('a', 'b', 'return a * ' + i + ' + b;'));",
+    "    }",
+    "    return functions;",
+    "}",
+    "function run(functions, rounds) {",
+    "    var sum = 0;",
+    "    for (var round = 0; round < rounds; round++) {",
+    "        for (var i = 0; i < functions.length; i++) {",
+    "            // Later functions are called more often, so they get hotter while they wait in the queue",
+    "            for (var j = 0; j <= i; j++) {",
+    "                sum = (sum + functions[i](round, j)) | 0;",
+    "            }",
+    "        }",
+    "    }",
+    "    return sum;",
+    "}"
+].join("\n");
+
+function expected(count, rounds) {
+    var sum = 0;
+    for (var round = 0; round < rounds; round++) {
+        for (var i = 0; i < count; i++) {
+            for (var j = 0; j <= i; j++) {
+                sum = (sum + (round * i + j)) | 0;
+            }
+        }
+    }
+    return sum;
+}
+
+eval(source);
+var other = WScript.LoadScript(source, "samethread");
+
+var functionCount = 24;
+var rounds = 200;
+var localFunctions = makeFunctions(functionCount);
+var otherFunctions = other.makeFunctions(functionCount);
+
+var passed = true;
+for (var iteration = 0; iteration < 3; iteration++) {
+    if (run(localFunctions, rounds) !== expected(functionCount, rounds) ||
+        other.run(otherFunctions, rounds) !== expected(functionCount, rounds)) {
+        passed = false;
+    }
+}
+
+WScript.Echo(passed ? "pass" : "fail");
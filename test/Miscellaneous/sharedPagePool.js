@@ -0,0 +1,64 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -SharedPagePoolMaxPageCount, so the empty segments that page allocators release are pooled, and
+// -ForceDecommitOnCollect, so that every collection releases them. The main runtime and the agent runtimes,
+// each with their own page allocators on their own thread, then allocate out of segments that the others
+// gave up. Debug builds check that the recycler only gets zeroed memory and that free pages stay protected.
+
+function churn(seed) {
+    var sum = 0;
+    for (var round = 0; round < 6; round++) {
+        var objects = [];
+        for (var i = 0; i < 20000; i++) {
+            objects.push({ a: i, b: seed, c: [i, i + 1], s: "s" + i });
+        }
+
+        var large = new Array(200000);
+        for (var i = 0; i < large.length; i++) {
+            large[i] = i + round;
+        }
+        var floats = new Float64Array(100000);
+        floats[floats.length - 1] = seed;
+
+        for (var i = 0; i < objects.length; i++) {
+            var o = objects[i];
+            sum = (sum + o.a + o.b + o.c[1] + o.s.length) | 0;
+        }
+        sum = (sum + large[large.length - 1] + floats[floats.length - 1] + floats[0]) | 0;
+
+        // New objects must look empty, whoever used their memory before
+        var holes = new Array(1000);
+        if (holes[999] !== undefined || Object.keys({}).length !== 0) {
+            throw new Error("Reused memory wasn't zeroed");
+        }
+
+        objects = null;
+        large = null;
+        floats = null;
+        CollectGarbage();
+    }
+    return sum;
+}
+
+var agentCount = 3;
+for (var agent = 0; agent < agentCount; agent++) {
+    // The parent waits for the agent's script to finish, so the agents run one after another
+    WScript.LoadScript(churn.toString() + "\nWScript.Report(churn(" + agent + "));", "crossthread");
+}
+
+var passed = true;
+for (var agent = 0; agent < agentCount; agent++) {
+    var expected = String(churn(agent));
+    var report = WScript.GetReport();
+    if (report !== expected) {
+        passed = false;
+        print("FAILED. Agent " + agent + ": expected " + expected + ", received " + report);
+    }
+}
+
+if (passed) {
+    print("PASSED");
+}
@@ -0,0 +1,48 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// UTF-8 transcoding of large, mostly ASCII sources. new Function encodes its source to UTF-8 and
+// Function.prototype.toString decodes it back, so both directions of the codex's ASCII runs are timed.
+// The source is mostly comments so that the parser doesn't dominate. One variant is pure ASCII and the
+// other has a non-ASCII character every few hundred characters, as a localized source would.
+
+if (typeof(WScript) === "undefined")
+{
+    var WScript = {
+        Echo: print
+    }
+}
+
+function buildBody(lineCount, nonAscii)
+{
+    var lines = [];
+    for (var i = 0; i < lineCount; i++)
+    {
+        lines.push("// Line " + i + " of a long comment that is only here to make the source larger; the parser skips it." +
+            (nonAscii && (i % 2) === 0 ? " é中" : ""));
+        if ((i % 100) === 0)
+        {
+            lines.push("total += " + i + ";");
+        }
+    }
+    return "var total = 0;\n" + lines.join("\n") + "\nreturn total;";
+}
+
+var asciiBody = buildBody(10000, false);
+var mixedBody = buildBody(10000, true);
+var length = 0;
+
+var _sunSpiderStartDate = new Date();
+
+for (var i = 0; i < 20; i++) {
+  // Different sources each time, so that nothing is cached
+  var ascii = new Function(asciiBody + "\n// " + i);
+  var mixed = new Function(mixedBody + "\n// " + i);
+  length += ascii.toString().length + mixed.toString().length + ascii() + mixed();
+}
+
+var _sunSpiderInterval = new Date() - _sunSpiderStartDate;
+
+WScript.Echo("### TIME:", _sunSpiderInterval, "ms");
@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse of a multi-megabyte API response, in the style of Kraken's json-parse-financial:
+// an array of records with the same shape, long string values, some escapes and mostly
+// integer numbers.
+
+if (typeof(WScript) === "undefined")
+{
+    var WScript = {
+        Echo: print
+    }
+}
+
+function buildResponse(recordCount)
+{
+    var stocks = ["AAPL", "MSFT", "JBLU", "MA", "GOOG", "AMZN", "INTC", "CSCO"];
+    var types = ["buy", "sell", "cover", "short"];
+    var records = [];
+    var seed = 12345;
+    function next()
+    {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed;
+    }
+
+    for (var i = 0; i < recordCount; i++)
+    {
+        var quantity = next() % 100000;
+        var price = (next() % 100000) / 100;
+        records.push({
+            id: 182000 + i,
+            type: types[next() % types.length],
+            stock: stocks[next() % stocks.length],
+            quantity: quantity,
+            price: price,
+            commission: next() % 5000,
+            total: Math.round(quantity * price),
+            date: "2008-10-17 23:56:06.000",
+            expires: "2008-10-20 16:00:00.000",
+            account: { id: next() % 1000000, region: "us-west", verified: (i % 3) !== 0 },
+            notes: "Order placed through the \"advanced\" trading interface.\nSettlement follows the standard T+3 schedule for this market; no further action is required by the account holder.",
+            tags: ["equity", "retail", stocks[i % stocks.length].toLowerCase()]
+        });
+    }
+
+    return JSON.stringify({ portfolio: records, withdrawals: 0, deposits: recordCount, inceptionDate: "2008-04-26 04:44:29.000" });
+}
+
+var data = buildResponse(8000);
+
+var _sunSpiderStartDate = new Date();
+
+for (var i = 0; i < 20; i++) {
+  var x = JSON.parse(data);
+}
+
+var _sunSpiderInterval = new Date() - _sunSpiderStartDate;
+
+WScript.Echo("### TIME:", _sunSpiderInterval, "ms");
@@ -26,6 +26,16 @@ else
        exit(1);
     }
 
+    if (system("perl perftest.pl -json @ARGV"))
+    {
+       exit(1);
+    }
+
+    if (system("perl perftest.pl -codex @ARGV"))
+    {
+       exit(1);
+    }
+
     if (system("perl perftest.pl -sunspider @ARGV"))
     {
        exit(1);
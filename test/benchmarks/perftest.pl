@@ -58,7 +58,7 @@ if($dir)
 }
 else
 {
-    print "Specify one of the benchmark octane, sunspider, kraken or jetsream\n";
+    print "Specify one of the benchmark octane, sunspider, kraken, json, codex or jetsream\n";
     print "or specify a directory of perf benchmark\n";
     print "and rerun this script with -baseline.\n";
     print "perl perftest.pl -? for more options. \n";
@@ -585,6 +585,8 @@ sub usage
     print "  -dynamicProfile        Force Run with dynamic profile info\n";
     print "  -sunspider             Run the sunspider 1.0.2 benchmark\n";
     print "  -kraken                Run the kraken benchmark\n";
+    print "  -json                  Run the JSON benchmark\n";
+    print "  -codex                 Run the UTF-8 codex benchmark\n";
     print "  -octane                Run the Octane 2.0 benchmark\n";
     print "  -jetstream             Run the JetStream benchmark (only non octane and sunspider tests)\n";
     print "  -file:<file>           Run the specified js file\n";
@@ -722,6 +724,32 @@ sub parse_args
             $testfile = "perftest$dir.txt";
             $highprecisiondate = 0;
         }
+        elsif($ARGV[$i] =~ /[-\/]json/i)
+        {
+            if($iter == $defaultIter)
+            {
+                $iter = 10;
+            }
+            @testlist = ("json-parse-large");
+            $testDescription = "JSON benchmark";
+            $dir = "JSON";
+            $basefile = "perfbase$dir.txt";
+            $testfile = "perftest$dir.txt";
+            $highprecisiondate = 0;
+        }
+        elsif($ARGV[$i] =~ /[-\/]codex/i)
+        {
+            if($iter == $defaultIter)
+            {
+                $iter = 10;
+            }
+            @testlist = ("utf8-transcode");
+            $testDescription = "UTF-8 codex benchmark";
+            $dir = "Codex";
+            $basefile = "perfbase$dir.txt";
+            $testfile = "perftest$dir.txt";
+            $highprecisiondate = 0;
+        }
         elsif($ARGV[$i] =~ /[-\/]sunspider/i)
         {
             @testlist = ("3d-cube", "3d-morph", "3d-raytrace", "access-binary-trees", "access-fannkuch",
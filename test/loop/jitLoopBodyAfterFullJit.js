@@ -0,0 +1,75 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The outer calls of these recursive chains start in the interpreter, and the inner calls send the function
+// to full JIT. When the outer frames get back to their loops, they move into jitted loop bodies, carrying
+// their locals, for-in enumerators, closures and arguments objects with them.
+
+function walk(depth, obj) {
+  var total = 0;
+  if (depth > 0) {
+    total += walk(depth - 1, obj);
+  }
+
+  for (var k in obj) {
+    total += obj[k] * depth;
+  }
+
+  var i = 0;
+  while (i < 50) {
+    total += i++ & depth;
+  }
+  return total;
+}
+
+function captured(depth) {
+  var count = 0;
+  var bump = function (n) { count += n; };
+  if (depth > 0) {
+    count += captured(depth - 1);
+  }
+  for (var i = 0; i < 20; i++) {
+    bump(i % (depth + 1));
+  }
+  return count;
+}
+
+function withArguments(depth) {
+  var sum = 0;
+  if (depth > 0) {
+    sum += withArguments(depth - 1, depth, depth * 2);
+  }
+  for (var i = 0; i < arguments.length; i++) {
+    sum += arguments[i];
+  }
+  return sum;
+}
+
+function enumerateDuringCall(depth, obj) {
+  var keys = "";
+  for (var k in obj) {
+    if (depth > 0 && k === "b") {
+      // The function goes to full JIT while this frame is in the middle of enumerating
+      keys += enumerateDuringCall(depth - 1, obj);
+    }
+    keys += k;
+  }
+  return keys;
+}
+
+var obj = { a: 1, b: 2, c: 3 };
+var results = [
+  walk(10, obj),
+  captured(10),
+  withArguments(10),
+  enumerateDuringCall(4, obj)
+];
+var expected = "1655,518,220,aaaaabcbcbcbcbc";
+
+if (results.join(",") !== expected) {
+  WScript.Echo("FAIL: " + results.join(","));
+} else {
+  WScript.Echo("PASS");
+}
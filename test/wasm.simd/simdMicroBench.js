@@ -0,0 +1,207 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Per-op microbenchmarks for the SIMD lowering. Every op runs in a loop over linear memory and its
+// result is checked against a scalar reference. Pass -args report -endargs to print the throughput
+// of each op with a larger iteration count.
+
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-constants.js");
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-module-builder.js");
+
+const report = WScript.Arguments[0] === "report";
+const iterations = report ? 1000000 : 1000;
+const runs = report ? 5 : 3;
+
+const kSimdPrefix = 0xfd;
+const kM128Load = 0x01;
+const kM128Store = 0x02;
+const kAlign4 = 2;
+
+// Memory layout: src1 at 0, src2 at 16, dst at 32
+const kSrc1 = 0;
+const kSrc2 = 16;
+const kDst = 32;
+
+const binaryOps = [
+    { name: "i32x4_add",  op: 0x1a, type: "i32", ref: (a, b) => (a + b) | 0 },
+    { name: "i32x4_mul",  op: 0x22, type: "i32", ref: (a, b) => Math.imul(a, b) },
+    { name: "i16x8_mul",  op: 0x21, type: "i16", ref: (a, b) => Math.imul(a, b) },
+    { name: "i8x16_lt_u", op: 0x53, type: "u8",  ref: (a, b) => a < b },
+    { name: "i16x8_lt_u", op: 0x55, type: "u16", ref: (a, b) => a < b },
+    { name: "i32x4_lt_u", op: 0x57, type: "u32", ref: (a, b) => a < b },
+    { name: "i8x16_le_u", op: 0x5b, type: "u8",  ref: (a, b) => a <= b },
+    { name: "i16x8_le_u", op: 0x5d, type: "u16", ref: (a, b) => a <= b },
+    { name: "i32x4_le_u", op: 0x5f, type: "u32", ref: (a, b) => a <= b },
+    { name: "i8x16_gt_u", op: 0x63, type: "u8",  ref: (a, b) => a > b },
+    { name: "i16x8_gt_u", op: 0x65, type: "u16", ref: (a, b) => a > b },
+    { name: "i32x4_gt_u", op: 0x67, type: "u32", ref: (a, b) => a > b },
+    { name: "i8x16_ge_u", op: 0x6b, type: "u8",  ref: (a, b) => a >= b },
+    { name: "i16x8_ge_u", op: 0x6d, type: "u16", ref: (a, b) => a >= b },
+    { name: "i32x4_ge_u", op: 0x6f, type: "u32", ref: (a, b) => a >= b },
+];
+
+const extractOps = [
+    { name: "i8x16_extract_lane_s", op: 0x09, type: "i8",  lanes: [0, 5, 15] },
+    { name: "i8x16_extract_lane_u", op: 0x0a, type: "u8",  lanes: [0, 6, 13] },
+    { name: "i32x4_extract_lane",   op: 0x0d, type: "i32", lanes: [0, 1, 3] },
+];
+
+const replaceOps = [
+    { name: "i8x16_replace_lane", op: 0x11, type: "i8",  lanes: [0, 7, 15] },
+    { name: "i32x4_replace_lane", op: 0x13, type: "i32", lanes: [0, 2, 3] },
+];
+
+function loadSrc(offset) {
+    return [kExprI32Const, 0, kSimdPrefix, kM128Load, kAlign4, offset];
+}
+
+// Decrements the counter in local 0 and loops while it is not 0
+const loopTail = [
+    kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub, kExprTeeLocal, 0,
+    kExprBrIf, 0,
+    kExprEnd,
+];
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, 1, false);
+builder.exportMemoryAs("memory");
+
+for (const { name, op } of binaryOps) {
+    builder.addFunction(name, kSig_v_i).addBody([
+        kExprLoop, kWasmStmt,
+            kExprI32Const, kDst,
+            ...loadSrc(kSrc1),
+            ...loadSrc(kSrc2),
+            kSimdPrefix, op,
+            kSimdPrefix, kM128Store, kAlign4, 0,
+        ...loopTail,
+    ]).exportFunc();
+}
+
+for (const { name, op, lanes } of extractOps) {
+    for (const lane of lanes) {
+        builder.addFunction(`${name}${lane}`, kSig_i_i).addLocals({ i32_count: 1 }).addBody([
+            kExprLoop, kWasmStmt,
+                kExprGetLocal, 1,
+                ...loadSrc(kSrc1),
+                kSimdPrefix, op, lane,
+                kExprI32Add,
+                kExprSetLocal, 1,
+            ...loopTail,
+            kExprGetLocal, 1,
+        ]).exportFunc();
+    }
+}
+
+for (const { name, op, lanes } of replaceOps) {
+    for (const lane of lanes) {
+        builder.addFunction(`${name}${lane}`, kSig_v_i).addBody([
+            kExprLoop, kWasmStmt,
+                kExprI32Const, kDst,
+                ...loadSrc(kSrc1),
+                kExprGetLocal, 0,
+                kSimdPrefix, op, lane,
+                kSimdPrefix, kM128Store, kAlign4, 0,
+            ...loopTail,
+        ]).exportFunc();
+    }
+}
+
+const exports = builder.instantiate().exports;
+const buffer = exports.memory.buffer;
+const views = {
+    "i8"  : new Int8Array(buffer),
+    "u8"  : new Uint8Array(buffer),
+    "i16" : new Int16Array(buffer),
+    "u16" : new Uint16Array(buffer),
+    "i32" : new Int32Array(buffer),
+    "u32" : new Uint32Array(buffer),
+};
+const laneCount = { "i8" : 16, "u8" : 16, "i16" : 8, "u16" : 8, "i32" : 4, "u32" : 4 };
+// Comparisons set all the bits of the lanes that are true
+const allOnes = { "u8" : 0xff, "u16" : 0xffff, "u32" : 0xffffffff };
+
+let passed = true;
+
+function assertEquals(expected, actual, msg) {
+    if (expected !== actual) {
+        passed = false;
+        throw `${msg}: expected ${expected}, received ${actual}`;
+    }
+}
+
+function fillSources() {
+    const bytes = views["u8"];
+    for (let i = 0; i < 32; i++) {
+        // Spread the values across the whole lane range, with some lanes equal between the sources
+        bytes[kSrc1 + i] = (i * 37 + 11) & 0xff;
+        bytes[kSrc2 + i] = ((i >> 2) % 3 == 0) ? bytes[kSrc1 + i] : (i * 91 + 200) & 0xff;
+    }
+}
+
+function run(name, fn) {
+    let result;
+    const start = Date.now();
+    for (let i = 0; i < runs; i++) {
+        result = fn();
+    }
+    const elapsed = Date.now() - start;
+    if (report) {
+        const opsPerMs = elapsed > 0 ? Math.round(runs * iterations / elapsed) : "inf";
+        print(`${name}: ${opsPerMs} ops/ms`);
+    }
+    return result;
+}
+
+for (const { name, type, ref } of binaryOps) {
+    fillSources();
+    run(name, () => exports[name](iterations));
+
+    const view = views[type];
+    const n = laneCount[type];
+    const src1 = kSrc1 / view.BYTES_PER_ELEMENT;
+    const src2 = kSrc2 / view.BYTES_PER_ELEMENT;
+    const dst = kDst / view.BYTES_PER_ELEMENT;
+    const lane = new view.constructor(1);
+    for (let i = 0; i < n; i++) {
+        const expected = ref(view[src1 + i], view[src2 + i]);
+        if (typeof expected === "boolean") {
+            lane[0] = expected ? allOnes[type] : 0;
+        } else {
+            // Wrap the reference result to the lane width
+            lane[0] = expected;
+        }
+        assertEquals(lane[0], view[dst + i], `${name} lane ${i}`);
+    }
+}
+
+for (const { name, type, lanes } of extractOps) {
+    fillSources();
+    const view = views[type];
+    for (const lane of lanes) {
+        const result = run(`${name}${lane}`, () => exports[`${name}${lane}`](iterations));
+        assertEquals(Math.imul(view[kSrc1 / view.BYTES_PER_ELEMENT + lane], iterations), result, `${name} lane ${lane}`);
+    }
+}
+
+for (const { name, type, lanes } of replaceOps) {
+    fillSources();
+    const view = views[type];
+    const n = laneCount[type];
+    const src1 = kSrc1 / view.BYTES_PER_ELEMENT;
+    const dst = kDst / view.BYTES_PER_ELEMENT;
+    for (const lane of lanes) {
+        run(`${name}${lane}`, () => exports[`${name}${lane}`](iterations));
+        for (let i = 0; i < n; i++) {
+            // The last value stored is from the final iteration, when the counter is 1
+            const expected = i === lane ? 1 : view[src1 + i];
+            assertEquals(expected, view[dst + i], `${name}${lane} lane ${i}`);
+        }
+    }
+}
+
+if (passed) {
+    print("PASSED");
+}
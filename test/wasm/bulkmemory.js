@@ -0,0 +1,169 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-constants.js");
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-module-builder.js");
+
+const kBulkMemoryPrefix = 0xfc;
+const kExprMemoryCopy = 0x0a;
+const kExprMemoryFill = 0x0b;
+const kExprTableCopy = 0x0e;
+const kTableSize = 8;
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, 1, false);
+builder.exportMemoryAs("memory");
+
+const getArgs = [kExprGetLocal, 0, kExprGetLocal, 1, kExprGetLocal, 2];
+builder.addFunction("copy", kSig_v_iii).addBody([
+  ...getArgs,
+  kBulkMemoryPrefix, kExprMemoryCopy, 0, 0,
+]).exportFunc();
+builder.addFunction("fill", kSig_v_iii).addBody([
+  ...getArgs,
+  kBulkMemoryPrefix, kExprMemoryFill, 0,
+]).exportFunc();
+builder.addFunction("tableCopy", kSig_v_iii).addBody([
+  ...getArgs,
+  kBulkMemoryPrefix, kExprTableCopy, 0, 0,
+]).exportFunc();
+
+// Copies 16 bytes from src to dst until the counter in local 0 reaches 0, to get the loop jitted
+builder.addFunction("copyLoop", kSig_v_iii).addBody([
+  kExprLoop, kWasmStmt,
+    kExprGetLocal, 1,
+    kExprGetLocal, 2,
+    kExprI32Const, 16,
+    kBulkMemoryPrefix, kExprMemoryCopy, 0, 0,
+    kExprGetLocal, 0, kExprI32Const, 1, kExprI32Sub, kExprTeeLocal, 0,
+    kExprBrIf, 0,
+  kExprEnd,
+]).exportFunc();
+
+// The table holds functions returning their initial index, the last 2 entries are empty
+const sig_i_v = builder.addType(kSig_i_v);
+const tableFuncs = [];
+for (let i = 0; i < kTableSize - 2; ++i) {
+  tableFuncs.push(builder.addFunction("t" + i, sig_i_v).addBody([kExprI32Const, i]).index);
+}
+builder.appendToTable(tableFuncs);
+builder.setFunctionTableLength(kTableSize);
+builder.addFunction("callAt", kSig_i_i).addBody([
+  kExprGetLocal, 0,
+  kExprCallIndirect, sig_i_v, kTableZero,
+]).exportFunc();
+
+const {exports} = builder.instantiate();
+const heap = new Uint8Array(exports.memory.buffer);
+
+let passed = true;
+function check(expected, actual, msg) {
+  if (expected !== actual) {
+    passed = false;
+    print(`FAILED. ${msg}: expected ${expected}, received ${actual}`);
+  }
+}
+
+function checkTrap(fn, msg) {
+  try {
+    fn();
+    passed = false;
+    print(`FAILED. ${msg}: expected a trap`);
+  } catch (e) {
+    if (!(e instanceof WebAssembly.RuntimeError)) {
+      passed = false;
+      print(`FAILED. ${msg}: unexpected error ${e}`);
+    }
+  }
+}
+
+function reset() {
+  for (let i = 0; i < 256; ++i) {
+    heap[i] = i;
+  }
+}
+
+function checkBytes(start, expected, msg) {
+  for (let i = 0; i < expected.length; ++i) {
+    check(expected[i], heap[start + i], `${msg} byte ${start + i}`);
+  }
+}
+
+function range(start, length) {
+  return Array.from({length}, (_, i) => start + i);
+}
+
+// memory.copy
+reset();
+exports.copy(100, 0, 10);
+checkBytes(100, range(0, 10), "copy");
+checkBytes(110, [110], "copy past the end of the range");
+
+// Overlapping ranges must behave like memmove in both directions
+reset();
+exports.copy(4, 0, 8);
+checkBytes(0, [0, 1, 2, 3, ...range(0, 8), 12], "overlapping copy forward");
+reset();
+exports.copy(0, 4, 8);
+checkBytes(0, [...range(4, 8), 8, 9, 10, 11, 12], "overlapping copy backward");
+
+// Copy to the last byte, and zero length copies at the end of the memory
+exports.copy(kPageSize - 1, 0, 1);
+check(4, heap[kPageSize - 1], "copy to the last byte");
+exports.copy(kPageSize, 0, 0);
+exports.copy(0, kPageSize, 0);
+
+// Out of bounds copies trap before writing anything
+reset();
+checkTrap(() => exports.copy(kPageSize - 4, 0, 8), "copy dst out of bounds");
+checkBytes(kPageSize - 4, [0, 0, 0, 4], "no partial copy");
+checkTrap(() => exports.copy(0, kPageSize - 4, 8), "copy src out of bounds");
+checkBytes(0, range(0, 8), "no partial copy");
+checkTrap(() => exports.copy(kPageSize + 1, 0, 0), "zero length copy past the end");
+checkTrap(() => exports.copy(0, -1, 2), "copy with a src that overflows 32 bits");
+checkTrap(() => exports.copy(1, 0, -1), "copy with a count that overflows 32 bits");
+
+// memory.fill, only the low byte of the value is used
+reset();
+exports.fill(10, 0x1ab, 5);
+checkBytes(8, [8, 9, 0xab, 0xab, 0xab, 0xab, 0xab, 15], "fill");
+exports.fill(kPageSize, 0, 0);
+checkTrap(() => exports.fill(kPageSize - 2, 0xff, 4), "fill out of bounds");
+checkBytes(kPageSize - 2, [0, 4], "no partial fill");
+checkTrap(() => exports.fill(8, 0, -1), "fill with a count that overflows 32 bits");
+
+// A loop that's hot enough to be jitted
+reset();
+exports.copyLoop(1000, 200, 16);
+checkBytes(200, range(16, 16), "copy loop");
+checkTrap(() => exports.copyLoop(1000, kPageSize - 8, 0), "copy loop out of bounds");
+
+// table.copy
+function checkTable(expected, msg) {
+  for (let i = 0; i < kTableSize; ++i) {
+    if (expected[i] === null) {
+      checkTrap(() => exports.callAt(i), `${msg} entry ${i}`);
+    } else {
+      check(expected[i], exports.callAt(i), `${msg} entry ${i}`);
+    }
+  }
+}
+
+checkTable([0, 1, 2, 3, 4, 5, null, null], "initial table");
+exports.tableCopy(1, 0, 3);
+checkTable([0, 0, 1, 2, 4, 5, null, null], "overlapping table copy forward");
+exports.tableCopy(0, 1, 3);
+checkTable([0, 1, 2, 2, 4, 5, null, null], "overlapping table copy backward");
+exports.tableCopy(2, 5, 3);
+checkTable([0, 1, 5, null, null, 5, null, null], "copy of empty entries");
+exports.tableCopy(kTableSize, 0, 0);
+checkTrap(() => exports.tableCopy(6, 0, 3), "table copy dst out of bounds");
+checkTrap(() => exports.tableCopy(0, 6, 3), "table copy src out of bounds");
+checkTrap(() => exports.tableCopy(0, 0, -1), "table copy with a count that overflows 32 bits");
+checkTable([0, 1, 5, null, null, 5, null, null], "no partial table copy");
+
+if (passed) {
+  print("PASSED");
+}
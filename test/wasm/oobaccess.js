@@ -0,0 +1,214 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Out of bounds loads and stores of every width. With -WasmFastArray, the jitted accesses have no bounds
+// checks and trap through the hardware exception filter, so the results must match the explicit checks.
+
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-constants.js");
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-module-builder.js");
+
+function leb(value) {
+  const bytes = [];
+  do {
+    let byte = value & 0x7f;
+    value = Math.floor(value / 128);
+    if (value !== 0) {
+      byte |= 0x80;
+    }
+    bytes.push(byte);
+  } while (value !== 0);
+  return bytes;
+}
+
+const kSig_i_ii_ = makeSig([kWasmI32, kWasmI32], [kWasmI32]);
+const kSig_d_i = makeSig([kWasmI32], [kWasmF64]);
+
+// Each access is in its own function with the index as param 0 and a constant offset
+const loads = [
+  { name: "i32",     op: kExprI32LoadMem,     size: 4, sig: kSig_i_i, tail: [] },
+  { name: "i32_8u",  op: kExprI32LoadMem8U,   size: 1, sig: kSig_i_i, tail: [] },
+  { name: "i32_16s", op: kExprI32LoadMem16S,  size: 2, sig: kSig_i_i, tail: [] },
+  { name: "i64",     op: kExprI64LoadMem,     size: 8, sig: kSig_i_i, tail: [kExprI32ConvertI64] },
+  { name: "i64_32u", op: kExprI64LoadMem32U,  size: 4, sig: kSig_i_i, tail: [kExprI32ConvertI64] },
+  { name: "f32",     op: kExprF32LoadMem,     size: 4, sig: kSig_d_i, tail: [kExprF64ConvertF32] },
+  { name: "f64",     op: kExprF64LoadMem,     size: 8, sig: kSig_d_i, tail: [] },
+];
+const stores = [
+  { name: "i32",     op: kExprI32StoreMem,    size: 4, value: [kExprGetLocal, 1] },
+  { name: "i32_8",   op: kExprI32StoreMem8,   size: 1, value: [kExprGetLocal, 1] },
+  { name: "i32_16",  op: kExprI32StoreMem16,  size: 2, value: [kExprGetLocal, 1] },
+  { name: "i64",     op: kExprI64StoreMem,    size: 8, value: [kExprGetLocal, 1, kExprI64SConvertI32] },
+  { name: "i64_32",  op: kExprI64StoreMem32,  size: 4, value: [kExprGetLocal, 1, kExprI64SConvertI32] },
+  { name: "f64",     op: kExprF64StoreMem,    size: 8, value: [kExprGetLocal, 1, kExprF64SConvertI32] },
+];
+const offsets = [0, 4, 0xfff0];
+
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, 4, false);
+builder.exportMemoryAs("memory");
+
+for (const { name, op, sig, tail } of loads) {
+  for (const offset of offsets) {
+    builder.addFunction(`load_${name}_${offset}`, sig).addBody([
+      kExprGetLocal, 0,
+      op, 0, ...leb(offset),
+      ...tail,
+    ]).exportFunc();
+  }
+}
+for (const { name, op, value } of stores) {
+  for (const offset of offsets) {
+    builder.addFunction(`store_${name}_${offset}`, kSig_v_ii).addBody([
+      kExprGetLocal, 0,
+      ...value,
+      op, 0, ...leb(offset),
+    ]).exportFunc();
+  }
+}
+
+// Sums the i32s from param 0 up to param 1, so that the trap happens in a jitted loop
+builder.addFunction("sum", kSig_i_ii_).addLocals({ i32_count: 1 }).addBody([
+  kExprLoop, kWasmStmt,
+    kExprGetLocal, 2,
+    kExprGetLocal, 0,
+    kExprI32LoadMem, 0, 0,
+    kExprI32Add,
+    kExprSetLocal, 2,
+    kExprGetLocal, 0, kExprI32Const, 4, kExprI32Add, kExprTeeLocal, 0,
+    kExprGetLocal, 1,
+    kExprI32LtU,
+    kExprBrIf, 0,
+  kExprEnd,
+  kExprGetLocal, 2,
+]).exportFunc();
+
+// Stores at param 0 through a nested call, to check that the trap unwinds the wasm frames
+const storeIndex = builder.addFunction("storeInner", kSig_v_ii).addBody([
+  kExprGetLocal, 0, kExprGetLocal, 1,
+  kExprI32StoreMem, 0, 0,
+]).index;
+builder.addFunction("storeNested", kSig_v_ii).addBody([
+  kExprGetLocal, 0, kExprGetLocal, 1,
+  kExprCallFunction, storeIndex,
+]).exportFunc();
+
+builder.addFunction("grow", kSig_i_i).addBody([
+  kExprGetLocal, 0,
+  kExprGrowMemory, kMemoryZero,
+]).exportFunc();
+
+const {exports} = builder.instantiate();
+
+let passed = true;
+function check(expected, actual, msg) {
+  if (!Object.is(expected, actual)) {
+    passed = false;
+    print(`FAILED. ${msg}: expected ${expected}, received ${actual}`);
+  }
+}
+
+function checkTrap(fn, msg) {
+  try {
+    fn();
+    passed = false;
+    print(`FAILED. ${msg}: expected a trap`);
+  } catch (e) {
+    if (!(e instanceof WebAssembly.RuntimeError)) {
+      passed = false;
+      print(`FAILED. ${msg}: unexpected error ${e}`);
+    }
+  }
+}
+
+function memorySize() {
+  return exports.memory.buffer.byteLength;
+}
+
+function heap() {
+  return new Uint8Array(exports.memory.buffer);
+}
+
+function testLoads() {
+  const size = memorySize();
+  for (const { name, size: width } of loads) {
+    for (const offset of offsets) {
+      const load = exports[`load_${name}_${offset}`];
+      const last = size - width - offset;
+      check(0, +load(last), `load ${name} offset ${offset} at the last valid index`);
+      checkTrap(() => load(last + 1), `load ${name} offset ${offset} one past the end`);
+      checkTrap(() => load(size), `load ${name} offset ${offset} at the end`);
+      checkTrap(() => load(-1), `load ${name} offset ${offset} at 0xffffffff`);
+      checkTrap(() => load(-width), `load ${name} offset ${offset} wrapping around 4GB`);
+    }
+  }
+}
+
+function testStores() {
+  const size = memorySize();
+  for (const { name, size: width } of stores) {
+    for (const offset of offsets) {
+      const store = exports[`store_${name}_${offset}`];
+      const last = size - width - offset;
+      store(last, 1);
+      check(true, heap().subarray(size - width).some(byte => byte !== 0), `store ${name} offset ${offset} at the last valid index`);
+      heap().fill(0, size - width);
+
+      // Nothing is written by a store that is partially out of bounds
+      checkTrap(() => store(last + 1, -1), `store ${name} offset ${offset} one past the end`);
+      for (let i = size - width; i < size; ++i) {
+        check(0, heap()[i], `store ${name} offset ${offset} partial write at ${i}`);
+      }
+      checkTrap(() => store(-1, -1), `store ${name} offset ${offset} at 0xffffffff`);
+      checkTrap(() => store(-width, -1), `store ${name} offset ${offset} wrapping around 4GB`);
+    }
+  }
+}
+
+function testLoop() {
+  const size = memorySize();
+  const i32 = new Int32Array(exports.memory.buffer);
+  i32[i32.length - 1] = 5;
+  i32[i32.length - 2] = 6;
+  check(11, exports.sum(size - 8, size), "sum of the last i32s");
+  checkTrap(() => exports.sum(size - 8, size + 8), "sum past the end");
+  i32[i32.length - 1] = 0;
+  i32[i32.length - 2] = 0;
+}
+
+function testNested() {
+  // Every trap must leave the stack as it was, so repeat it
+  for (let i = 0; i < 1000; ++i) {
+    checkTrap(() => exports.storeNested(memorySize(), i), "nested store");
+  }
+  exports.storeNested(0, 42);
+  check(42, heap()[0], "nested store after the traps");
+  heap()[0] = 0;
+}
+
+// Run enough times for the functions to be jitted
+for (let i = 0; i < 3; ++i) {
+  testLoads();
+  testStores();
+  testLoop();
+  testNested();
+}
+
+// Growing the memory makes the old out of bounds indices valid
+const oldSize = memorySize();
+check(1, exports.grow(1), "grow");
+exports.store_i32_0(oldSize, 7);
+check(7, exports.load_i32_0(oldSize), "load from the grown memory");
+exports.store_i32_0(oldSize, 0);
+testLoads();
+testStores();
+testLoop();
+
+// Can't grow past the maximum, and the accesses still trap at the same place
+check(-1, exports.grow(4), "grow past the maximum");
+testLoads();
+
+if (passed) {
+  print("PASSED");
+}
@@ -0,0 +1,114 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-constants.js");
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-module-builder.js");
+
+// Enough code for the validation to be split across several jobs
+const nFunctions = 200;
+const nPadding = 400;
+
+function buildModule(invalidFunctions = []) {
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < nFunctions; ++i) {
+    const body = [];
+    for (let j = 0; j < nPadding; ++j) {
+      body.push(kExprI32Const, j & 0x3f, kExprDrop);
+    }
+    if (invalidFunctions.includes(i)) {
+      // i64 result in an i32 function
+      body.push(kExprI64Const, 1);
+    } else {
+      body.push(
+        kExprI32Const, i,
+        kExprSetLocal, 1,
+        kExprGetLocal, 0,
+        kExprGetLocal, 1,
+        kExprI32Add
+      );
+    }
+    builder
+      .addFunction("f" + i, kSig_i_i)
+      .addLocals({i32_count: 1})
+      .addBody(body)
+      .exportFunc();
+  }
+  return builder.toBuffer();
+}
+
+function checkCompileError(buffer, expectedName) {
+  try {
+    new WebAssembly.Module(buffer);
+    print(`FAILED. Expected a compile error in ${expectedName}`);
+  } catch (e) {
+    if (!(e instanceof WebAssembly.CompileError) || !e.message.includes(`function ${expectedName} `)) {
+      print(`FAILED. Unexpected error: ${e.message}`);
+    }
+  }
+}
+
+const {exports} = new WebAssembly.Instance(new WebAssembly.Module(buildModule()));
+for (let i = 0; i < nFunctions; ++i) {
+  const result = exports["f" + i](1000);
+  if (result !== 1000 + i) {
+    print(`FAILED. f${i}(1000) returned ${result}`);
+  }
+}
+
+checkCompileError(buildModule([0]), "f0");
+checkCompileError(buildModule([137]), "f137");
+checkCompileError(buildModule([nFunctions - 1]), "f" + (nFunctions - 1));
+// The first invalid function in index order is reported
+checkCompileError(buildModule([150, 42, 199]), "f42");
+
+// Deeply nested blocks in one function among enough others to be validated on a job thread. Job threads can
+// have a smaller stack than the main thread, so a body that is too deep for them must fail over to the main
+// thread instead of overflowing, and one too deep for either must fail to compile.
+function buildNestedModule(depth) {
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < nFunctions; ++i) {
+    const body = [];
+    if (i === nFunctions / 2) {
+      for (let j = 0; j < depth; ++j) {
+        body.push(kExprBlock, kWasmStmt);
+      }
+      for (let j = 0; j < depth; ++j) {
+        body.push(kExprEnd);
+      }
+    }
+    for (let j = 0; j < nPadding; ++j) {
+      body.push(kExprI32Const, j & 0x3f, kExprDrop);
+    }
+    body.push(kExprGetLocal, 0);
+    builder.addFunction("n" + i, kSig_i_i).addBody(body).exportFunc();
+  }
+  return builder.toBuffer();
+}
+
+for (const depth of [100, 500]) {
+  const nested = new WebAssembly.Instance(new WebAssembly.Module(buildNestedModule(depth))).exports;
+  const result = nested["n" + nFunctions / 2](depth);
+  if (result !== depth) {
+    print(`FAILED. Nested blocks of depth ${depth} returned ${result}`);
+  }
+}
+
+try {
+  new WebAssembly.Module(buildNestedModule(1000000));
+  print("FAILED. Expected a compile error for too deeply nested blocks");
+} catch (e) {
+  if (!(e instanceof WebAssembly.CompileError)) {
+    print(`FAILED. Unexpected error for too deeply nested blocks: ${e.message}`);
+  }
+}
+
+WebAssembly.compile(buildModule([99])).then(
+  () => print("FAILED. WebAssembly.compile should have rejected"),
+  e => {
+    if (!(e instanceof WebAssembly.CompileError) || !e.message.includes("function f99 ")) {
+      print(`FAILED. Unexpected error: ${e.message}`);
+    }
+    print("PASSED");
+  });